@@ -52,6 +52,9 @@ namespace CASM {
       StatusOption dumbstatus;
       casm_engine.push_back(Option(dumbstatus.tag(), dumbstatus.desc()));
 
+      ServerOption dumbserver;
+      casm_engine.push_back(Option(dumbserver.tag(), dumbserver.desc()));
+
       SuperOption dumbsuper;
       casm_engine.push_back(Option(dumbsuper.tag(), dumbsuper.desc()));
 
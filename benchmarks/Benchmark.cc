@@ -0,0 +1,75 @@
+#include "Benchmark.hh"
+
+#include <cstdlib>
+#include <memory>
+#include <boost/filesystem.hpp>
+
+#include "Common.hh"
+#include "casm/app/casm_functions.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/version/version.hh"
+
+namespace bench {
+
+  jsonParser &results() {
+    static jsonParser json;
+    if(!json.contains("benchmarks")) {
+      json["version"] = version();
+      json["min_time"] = min_time();
+      json["benchmarks"] = jsonParser::object();
+    }
+    return json;
+  }
+
+  void write_results() {
+    const char *path = std::getenv("CASM_BENCHMARK_RESULTS");
+    fs::path results_path = path ? fs::path(path) : fs::path("benchmark_results.json");
+    results().write(results_path);
+    std::cout << "write: " << fs::absolute(results_path) << std::endl;
+  }
+
+  double min_time() {
+    const char *val = std::getenv("CASM_BENCHMARK_MIN_TIME");
+    return val ? std::stod(val) : 1.0;
+  }
+
+  void record(const std::string &name, Index calls, double ops, double seconds) {
+    jsonParser &json = results()["benchmarks"][name];
+    json["calls"] = calls;
+    json["ops"] = ops;
+    json["seconds"] = seconds;
+    json["ops_per_second"] = ops / seconds;
+    json["seconds_per_op"] = seconds / ops;
+
+    std::cout << name << ": " << ops / seconds << " ops/s" << std::endl;
+  }
+
+  PrimClex &ZrO_clex() {
+    static test::ZrOProj proj;
+    static std::unique_ptr<PrimClex> primclex;
+
+    if(!primclex) {
+      proj.check_init();
+      proj.check_composition();
+
+      primclex.reset(new PrimClex(proj.dir, Logging::null()));
+
+      fs::path eci_dest = primclex->dir().eci("formation_energy", "default", "default", "default", "default");
+      fs::copy_file("tests/unit/monte_carlo/eci_0.json", eci_dest, fs::copy_option::overwrite_if_exists);
+
+      fs::path bspecs_dest = primclex->dir().bspecs("default");
+      fs::copy_file("tests/unit/monte_carlo/bspecs_0.json", bspecs_dest, fs::copy_option::overwrite_if_exists);
+
+      // for autotools
+      primclex->settings().set_casm_libdir(fs::current_path() / ".libs");
+      primclex->settings().commit();
+
+      CommandArgs args("casm bset -u", primclex.get(), primclex->dir().root_dir(), Logging::null());
+      if(casm_api(args)) {
+        throw std::runtime_error("Error in bench::ZrO_clex: 'casm bset -u' failed");
+      }
+    }
+    return *primclex;
+  }
+
+}
@@ -0,0 +1,81 @@
+#ifndef CASM_BENCHMARKS_Benchmark_HH
+#define CASM_BENCHMARKS_Benchmark_HH
+
+#include <chrono>
+#include <string>
+
+#include "casm/CASM_global_definitions.hh"
+#include "casm/casm_io/jsonParser.hh"
+
+namespace CASM {
+  class PrimClex;
+}
+
+namespace bench {
+
+  using namespace CASM;
+
+  /// \brief Results of all benchmarks run so far
+  ///
+  /// \code
+  /// {
+  ///   "version": "...",
+  ///   "min_time": 1.0,
+  ///   "benchmarks": {
+  ///     "<name>": {"calls": int, "ops": number, "seconds": number,
+  ///                "ops_per_second": number, "seconds_per_op": number},
+  ///     ...
+  ///   }
+  /// }
+  /// \endcode
+  jsonParser &results();
+
+  /// \brief Write results() to 'benchmark_results.json', or the path given by the
+  /// environment variable CASM_BENCHMARK_RESULTS
+  void write_results();
+
+  /// \brief Minimum time, in seconds, to run each benchmark
+  ///
+  /// Default is 1.0, or the value of the environment variable CASM_BENCHMARK_MIN_TIME
+  double min_time();
+
+  /// \brief Record the result of a benchmark
+  void record(const std::string &name, Index calls, double ops, double seconds);
+
+  /// \brief Time repeated calls of 'f' and record the result
+  ///
+  /// - 'f' is called once to warm up, and then in batches of doubling size until
+  ///   at least min_time() seconds have elapsed
+  /// - Each call of 'f' counts as 'ops_per_call' operations, for example the number
+  ///   of Monte Carlo steps it takes
+  ///
+  template<typename F>
+  void run(const std::string &name, F f, double ops_per_call = 1.0) {
+    typedef std::chrono::steady_clock clock;
+
+    f();
+
+    Index calls = 0;
+    Index batch = 1;
+    double seconds = 0.0;
+    while(seconds < min_time()) {
+      auto begin = clock::now();
+      for(Index i = 0; i < batch; ++i) {
+        f();
+      }
+      seconds += std::chrono::duration<double>(clock::now() - begin).count();
+      calls += batch;
+      batch *= 2;
+    }
+    record(name, calls, calls * ops_per_call, seconds);
+  }
+
+  /// \brief The ZrO test project, with the basis set and ECI used by the Monte Carlo
+  /// unit tests, and a PrimClex for it
+  ///
+  /// - Constructed by the first call, and shared by all benchmarks
+  PrimClex &ZrO_clex();
+
+}
+
+#endif
@@ -0,0 +1,14 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "CASM Benchmarks"
+#include <boost/test/unit_test.hpp>
+
+#include "Benchmark.hh"
+
+/// Write benchmark results after all benchmarks have run
+struct WriteBenchmarkResults {
+  ~WriteBenchmarkResults() {
+    bench::write_results();
+  }
+};
+
+BOOST_GLOBAL_FIXTURE(WriteBenchmarkResults);
@@ -0,0 +1,60 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being benchmarked:
+#include "casm/casm_io/jsonParser.hh"
+#include "casm/casm_io/json_io/container.hh"
+
+/// What is being used to benchmark it:
+#include "Benchmark.hh"
+#include "casm/misc/PhiloxRand.hh"
+
+using namespace CASM;
+
+namespace {
+
+  /// Construct a document shaped like a config_list.json: many objects, each with
+  /// a name, an occupation array, and some scalar properties
+  jsonParser _config_list(Index N_config, Index N_site) {
+    PhiloxRand random(0);
+    jsonParser json = jsonParser::object();
+    for(Index i = 0; i < N_config; ++i) {
+      std::string name = "SCEL" + std::to_string(N_site) + "_1_1_" + std::to_string(N_site) + "_0_0_0/" + std::to_string(i);
+      jsonParser &config = json[name];
+      std::vector<int> occ(N_site);
+      for(auto &val : occ) {
+        val = random.randInt(1);
+      }
+      config["occupation"] = occ;
+      config["selected"] = (i % 2 == 0);
+      config["properties"]["calc"]["relaxed_energy"] = random.rand53();
+      config["properties"]["calc"]["data_timestamp"] = 1000000000 + i;
+    }
+    return json;
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(CASMIOBenchmark)
+
+BOOST_AUTO_TEST_CASE(jsonParserBenchmark) {
+
+  jsonParser json = _config_list(1000, 64);
+
+  std::stringstream ss;
+  json.print(ss);
+  std::string str = ss.str();
+
+  // ops are bytes of JSON text
+
+  bench::run("jsonParser::print", [&]() {
+    std::stringstream ss;
+    json.print(ss);
+  }, str.size());
+
+  bench::run("jsonParser::parse", [&]() {
+    jsonParser::parse(str);
+  }, str.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,131 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being benchmarked:
+#include "casm/clex/Clexulator.hh"
+#include "casm/clex/ConfigEnumAllOccupations.hh"
+#include "casm/clex/ConfigMapping.hh"
+#include "casm/clex/Configuration.hh"
+
+/// What is being used to benchmark it:
+#include "Benchmark.hh"
+#include "Common.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/clex/ScelEnum.hh"
+#include "casm/misc/PhiloxRand.hh"
+
+using namespace CASM;
+
+namespace {
+
+  /// Set a random occupation, with a fixed seed so that runs are reproducible
+  void _random_occupation(Configuration &config, PhiloxRand &random) {
+    Array<int> max_occ = config.get_supercell().max_allowed_occupation();
+    for(Index l = 0; l < config.size(); ++l) {
+      config.set_occ(l, random.randInt(max_occ[l]));
+    }
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(ClexBenchmark)
+
+BOOST_AUTO_TEST_CASE(ClexulatorBenchmark) {
+
+  PrimClex &primclex = bench::ZrO_clex();
+  Clexulator clexulator = primclex.clexulator(primclex.settings().default_clex());
+
+  Supercell scel(&primclex, Eigen::Matrix3i::Identity() * 8);
+  Configuration config(scel);
+  PhiloxRand random(0);
+  _random_occupation(config, random);
+
+  bench::run("Clexulator::calc_global_corr_contribution", [&]() {
+    correlations(config.configdof(), scel, clexulator);
+  }, scel.volume());
+
+  // flip each site with more than one allowed occupant
+  Array<int> max_occ = scel.max_allowed_occupation();
+  std::vector<Index> sites;
+  for(Index l = 0; l < config.size(); ++l) {
+    if(max_occ[l]) {
+      sites.push_back(l);
+    }
+  }
+  BOOST_REQUIRE(sites.size());
+
+  Eigen::VectorXd dcorr(clexulator.corr_size());
+  clexulator.set_config_occ(config.occupation().begin());
+  bench::run("Clexulator::calc_delta_point_corr", [&]() {
+    for(Index l : sites) {
+      clexulator.set_nlist(scel.nlist().sites(scel.nlist().unitcell_index(l)).data());
+      clexulator.calc_delta_point_corr(scel.get_b(l), config.occ(l), (config.occ(l) + 1) % (max_occ[l] + 1), dcorr.data());
+    }
+  }, sites.size());
+}
+
+BOOST_AUTO_TEST_CASE(ConfigurationBenchmark) {
+
+  test::FCCTernaryProj proj;
+  proj.check_init();
+  PrimClex primclex(proj.dir, null_log());
+
+  // Configuration::to_canonical
+  {
+    Supercell scel(&primclex, Eigen::Matrix3i::Identity() * 3);
+    PhiloxRand random(0);
+    std::vector<Configuration> configs(100, Configuration(scel));
+    for(auto &config : configs) {
+      _random_occupation(config, random);
+    }
+
+    bench::run("Configuration::to_canonical", [&]() {
+      for(const auto &config : configs) {
+        config.to_canonical();
+      }
+    }, configs.size());
+  }
+
+  // ConfigEnumAllOccupations, in all supercells up to volume 4
+  std::vector<Supercell *> scels;
+  ScelEnumByProps scel_enum(primclex, ScelEnumProps(1, 5));
+  for(auto &scel : scel_enum) {
+    scels.push_back(&scel);
+  }
+
+  Index count = 0;
+  auto enumerate = [&]() {
+    count = 0;
+    for(Supercell *scel : scels) {
+      ConfigEnumAllOccupations config_enum(*scel);
+      count += std::distance(config_enum.begin(), config_enum.end());
+    }
+  };
+  enumerate();
+  bench::run("ConfigEnumAllOccupations", enumerate, count);
+
+  // ConfigMapper::import_structure, for the unique configurations in supercells up to volume 2
+  std::vector<BasicStructure<Site> > strucs;
+  for(Supercell *scel : scels) {
+    if(scel->volume() > 2) {
+      continue;
+    }
+    ConfigEnumAllOccupations config_enum(*scel);
+    for(const auto &config : config_enum) {
+      strucs.push_back(scel->superstructure(config));
+    }
+  }
+
+  ConfigMapper mapper(primclex, 0.5);
+  std::string imported_name;
+  jsonParser relaxation_properties;
+  std::vector<Index> best_assignment;
+  Eigen::Matrix3d cart_op;
+  bench::run("ConfigMapper::import_structure", [&]() {
+    for(const auto &struc : strucs) {
+      mapper.import_structure(struc, imported_name, relaxation_properties, best_assignment, cart_op);
+    }
+  }, strucs.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,40 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being benchmarked:
+#include "casm/crystallography/SupercellEnumerator.hh"
+
+/// What is being used to benchmark it:
+#include "Benchmark.hh"
+#include "Common.hh"
+#include "casm/crystallography/Lattice.hh"
+#include "casm/symmetry/SymGroup.hh"
+
+using namespace CASM;
+
+BOOST_AUTO_TEST_SUITE(CrystallographyBenchmark)
+
+BOOST_AUTO_TEST_CASE(SupercellEnumeratorBenchmark) {
+
+  // FCC and HCP (ZrO) lattices, which have the largest point groups
+  std::vector<std::pair<std::string, Lattice> > lattices = {
+    {"FCC", test::FCC_ternary_prim().lattice()},
+    {"HCP", test::ZrO_prim().lattice()}
+  };
+
+  for(const auto &val : lattices) {
+    const Lattice &lat = val.second;
+    SymGroup pg;
+    lat.generate_point_group(pg);
+
+    Index count = 0;
+    auto enumerate = [&]() {
+      SupercellEnumerator<Lattice> enumerator(lat, pg, ScelEnumProps(1, 13));
+      count = std::distance(enumerator.begin(), enumerator.end());
+    };
+    enumerate();
+    bench::run("SupercellEnumerator<Lattice>/" + val.first, enumerate, count);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,45 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being benchmarked:
+#include "casm/hull/Hull.hh"
+
+/// What is being used to benchmark it:
+#include "Benchmark.hh"
+#include "casm/clex/ConfigEnumAllOccupations.hh"
+#include "casm/clex/ConfigIO.hh"
+#include "casm/clex/ConfigSelection.hh"
+#include "casm/clex/Norm.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/clex/ScelEnum.hh"
+
+using namespace CASM;
+
+BOOST_AUTO_TEST_SUITE(HullBenchmark)
+
+BOOST_AUTO_TEST_CASE(ClexHullBenchmark) {
+
+  // all configurations in supercells up to volume 4, with the cluster expanded energy
+  PrimClex &primclex = bench::ZrO_clex();
+  ScelEnumByProps scel_enum(primclex, ScelEnumProps(1, 5));
+  for(auto &scel : scel_enum) {
+    ConfigEnumAllOccupations config_enum(scel);
+    for(const auto &config : config_enum) {
+      config.insert(false);
+    }
+  }
+
+  ConstConfigSelection selection(primclex, "ALL");
+  Index N_config = std::distance(selection.selected_config_begin(), selection.selected_config_end());
+  BOOST_REQUIRE(N_config);
+
+  ConfigIO::Clex clex;
+  clex.parse_args("formation_energy,per_species");
+  clex.init(*selection.selected_config_begin());
+
+  bench::run("Hull", [&]() {
+    Hull hull(selection, ConfigIO::SpeciesFrac(), clex);
+  }, N_config);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,74 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being benchmarked:
+#include "casm/monte_carlo/MonteDriver.hh"
+#include "casm/monte_carlo/canonical/Canonical.hh"
+#include "casm/monte_carlo/grand_canonical/GrandCanonical.hh"
+
+/// What is being used to benchmark it:
+#include "Benchmark.hh"
+#include "Common.hh"
+#include "casm/clex/PrimClex.hh"
+
+using namespace CASM;
+
+namespace {
+
+  /// Write Monte Carlo settings for a 10x10x10 supercell with a fixed random seed,
+  /// based on the Monte Carlo unit test settings, and return the path
+  fs::path _write_settings(const PrimClex &primclex, std::string ensemble) {
+
+    jsonParser json("tests/unit/monte_carlo/metropolis_grand_canonical_0.json");
+    json["ensemble"] = ensemble;
+    json["supercell"] = Eigen::Matrix3i(Eigen::Matrix3i::Identity() * 10);
+    json["data"]["storage"]["write_observations"] = false;
+    json["driver"]["random_seed"] = 0;
+    json["driver"]["motif"]["configname"] = "default";
+    if(ensemble == "canonical") {
+      for(std::string key : {"initial_conditions", "final_conditions", "incremental_conditions"}) {
+        jsonParser &cond = json["driver"][key];
+        cond.erase("param_chem_pot");
+        cond["comp"]["a"] = (key == "incremental_conditions") ? 0.0 : 0.5;
+      }
+    }
+
+    fs::path mc_dir = primclex.dir().root_dir() / ("bench_" + ensemble);
+    fs::create_directory(mc_dir);
+    fs::path settings_path = mc_dir / "settings.json";
+    json.write(settings_path);
+    return settings_path;
+  }
+
+  /// Benchmark Metropolis steps, run at the initial conditions
+  template<typename MCType>
+  void _benchmark_steps(std::string name, std::string ensemble) {
+
+    PrimClex &primclex = bench::ZrO_clex();
+    typename MCType::SettingsType settings(primclex, _write_settings(primclex, ensemble));
+
+    Log log = null_log();
+    MCType mc(primclex, settings, log);
+    mc.set_state(settings.initial_conditions(), settings);
+
+    Index steps = mc.steps_per_pass();
+    bench::run(name, [&]() {
+      for(Index i = 0; i < steps; ++i) {
+        monte_carlo_step(mc);
+      }
+    }, steps);
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(MonteCarloBenchmark)
+
+BOOST_AUTO_TEST_CASE(GrandCanonicalBenchmark) {
+  _benchmark_steps<GrandCanonical>("GrandCanonical/step", "grand_canonical");
+}
+
+BOOST_AUTO_TEST_CASE(CanonicalBenchmark) {
+  _benchmark_steps<Monte::Canonical>("Canonical/step", "canonical");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -46,6 +46,15 @@ namespace CASM {
 
   void write_symgroup(const SymGroup &grp, jsonParser &json);
 
+  /// \brief Read SymGroup tables cached in 'filename'
+  bool read_symgroup_tables(const SymGroup &grp, fs::path filename);
+
+  /// \brief Write SymGroup tables, generating them if necessary, to 'filename'
+  bool write_symgroup_tables(const SymGroup &grp, fs::path filename);
+
+  /// \brief Read SymGroup tables cached in 'filename', or generate them and write the cache
+  bool cache_symgroup_tables(const SymGroup &grp, fs::path filename);
+
 
   // --------- ChemicalReference IO Declarations --------------------------------------------------
 
@@ -124,6 +124,11 @@ namespace CASM {
       return m_root / m_casm_dir / "project_settings.json";
     }
 
+    /// \brief Return path of the Unix socket used by 'casm server'
+    fs::path server_socket() const {
+      return m_root / m_casm_dir / "server.sock";
+    }
+
     /// \brief Return master scel_list.json path
     fs::path scel_list(std::string scelname) const {
       return m_root / m_casm_dir / "scel_list.json";
@@ -134,6 +139,11 @@ namespace CASM {
       return m_root / m_casm_dir / "config_list.json";
     }
 
+    /// \brief Return cache of supercell lattices enumerated by volume
+    fs::path lattice_enum_cache() const {
+      return m_root / m_casm_dir / "lattice_enum_cache.json";
+    }
+
     /// \brief Return enumerators plugin dir
     fs::path enumerator_plugins() const {
       return m_root / m_casm_dir / "enumerators";
@@ -167,6 +177,11 @@ namespace CASM {
       return m_root / m_sym_dir / "crystal_point_group.json";
     }
 
+    /// \brief Return path of cached tables of a symmetry group, e.g. "lattice_point_group_tables.json"
+    fs::path symgroup_tables(std::string group_name) const {
+      return m_root / m_sym_dir / (group_name + "_tables.json");
+    }
+
 
     // -- Basis sets --------
 
@@ -210,6 +225,11 @@ namespace CASM {
       return bset_dir(bset) / (project + "_Clexulator.so");
     }
 
+    /// \brief Returns path to global clexulator data file
+    fs::path clexulator_data(std::string project, std::string bset) const {
+      return bset_dir(bset) / (project + "_Clexulator.json");
+    }
+
     /// \brief Returns path to eci.in, in bset directory
     fs::path eci_in(std::string bset) const {
       return bset_dir(bset) / "eci.in";
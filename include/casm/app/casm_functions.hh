@@ -193,6 +193,8 @@ namespace CASM {
 
   int select_command(const CommandArgs &args);
 
+  int server_command(const CommandArgs &args);
+
   int settings_command(const CommandArgs &args);
 
   int status_command(const CommandArgs &args);
@@ -174,6 +174,7 @@ namespace CASM {
   /// - clust.json
   /// - basis.json
   /// - X_Clexulator.cc
+  /// - X_Clexulator.json
   template<typename OutputIterator>
   OutputIterator FileEnumerator::bset_files(OutputIterator result) {
 
@@ -186,6 +187,7 @@ namespace CASM {
       result = _if_exists(result, m_dir.clust(bset));
       result = _if_exists(result, m_dir.basis(bset));
       result = _if_exists(result, m_dir.clexulator_src(m_set.name(), bset));
+      result = _if_exists(result, m_dir.clexulator_data(m_set.name(), bset));
     }
     return result;
   }
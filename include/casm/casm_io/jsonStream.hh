@@ -0,0 +1,361 @@
+#ifndef CASM_jsonStream
+#define CASM_jsonStream
+
+#include <cerrno>
+#include <cstdlib>
+#include <istream>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <boost/cstdint.hpp>
+
+namespace CASM {
+
+  /// \brief Reads JSON from a stream, calling a handler for each value as it is read
+  ///
+  /// - Use this for sequential access to large JSON files, without constructing a jsonParser
+  /// - Accepts the same input as jsonParser::read: standard JSON, plus '//' and '/* */'
+  ///   comments, '\\xHH' escapes, and '\\uHHHH' escapes truncated to a single char
+  /// - Integers are read as boost::int64_t if possible, else boost::uint64_t, else double
+  /// - Numbers are read independent of the global locale
+  /// - Throws std::runtime_error if the input is not valid JSON
+  ///
+  /// Handler must implement:
+  /// \code
+  /// void null_value();
+  /// void bool_value(bool value);
+  /// void int_value(boost::int64_t value);
+  /// void uint_value(boost::uint64_t value);
+  /// void real_value(double value);
+  /// void string_value(std::string &value);   // 'value' may be moved from
+  /// void key(std::string &name);             // 'name' may be moved from
+  /// void begin_object();
+  /// void end_object();
+  /// void begin_array();
+  /// void end_array();
+  /// \endcode
+  ///
+  /// Example, counting the configurations in a config_list.json file:
+  /// \code
+  /// struct ConfigCounter {
+  ///   int depth = 0;
+  ///   int count = 0;
+  ///   void begin_object() {
+  ///     if(++depth == 4) count++;
+  ///   }
+  ///   void end_object() {
+  ///     depth--;
+  ///   }
+  ///   ...
+  /// };
+  /// ConfigCounter counter;
+  /// read_json_stream(stream, counter);
+  /// \endcode
+  ///
+  /// \ingroup casmIO
+  ///
+  template<typename Handler>
+  class jsonStreamReader {
+
+  public:
+
+    jsonStreamReader(std::istream &stream, Handler &handler) :
+      m_buf(stream.rdbuf()),
+      m_handler(handler) {
+      m_real_stream.imbue(std::locale::classic());
+    }
+
+    /// \brief Read a single JSON value, which may be an object or array
+    void read() {
+      _skip_space();
+      _value();
+    }
+
+  private:
+
+    static int eof() {
+      return std::char_traits<char>::eof();
+    }
+
+    int _peek() {
+      return m_buf->sgetc();
+    }
+
+    int _get() {
+      return m_buf->sbumpc();
+    }
+
+    void _error(const std::string &what) {
+      throw std::runtime_error("Error reading JSON: " + what);
+    }
+
+    void _expect(char c) {
+      if(_get() != c) {
+        _error(std::string("expected '") + c + "'");
+      }
+    }
+
+    /// Skip whitespace and comments
+    void _skip_space() {
+      while(true) {
+        int c = _peek();
+        if(c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' || c == '\v') {
+          _get();
+        }
+        else if(c == '/') {
+          _get();
+          c = _get();
+          if(c == '/') {
+            while((c = _get()) != eof() && c != '\n') {}
+          }
+          else if(c == '*') {
+            int prev = 0;
+            while((c = _get()) != eof() && !(prev == '*' && c == '/')) {
+              prev = c;
+            }
+            if(c == eof()) {
+              _error("unterminated comment");
+            }
+          }
+          else {
+            _error("invalid comment");
+          }
+        }
+        else {
+          return;
+        }
+      }
+    }
+
+    void _value() {
+      int c = _peek();
+      if(c == '{') {
+        _object();
+      }
+      else if(c == '[') {
+        _array();
+      }
+      else if(c == '"') {
+        _string(m_str);
+        m_handler.string_value(m_str);
+      }
+      else if(c == 't') {
+        _literal("true");
+        m_handler.bool_value(true);
+      }
+      else if(c == 'f') {
+        _literal("false");
+        m_handler.bool_value(false);
+      }
+      else if(c == 'n') {
+        _literal("null");
+        m_handler.null_value();
+      }
+      else if(c == '-' || c == '+' || c == '.' || (c >= '0' && c <= '9')) {
+        _number();
+      }
+      else {
+        _error("not a value");
+      }
+    }
+
+    void _literal(const char *str) {
+      for(; *str; ++str) {
+        if(_get() != *str) {
+          _error("not a value");
+        }
+      }
+    }
+
+    void _object() {
+      _expect('{');
+      m_handler.begin_object();
+      _skip_space();
+      if(_peek() == '}') {
+        _get();
+        m_handler.end_object();
+        return;
+      }
+      while(true) {
+        if(_peek() != '"') {
+          _error("expected object member name");
+        }
+        _string(m_str);
+        m_handler.key(m_str);
+        _skip_space();
+        _expect(':');
+        _skip_space();
+        _value();
+        _skip_space();
+        int c = _get();
+        if(c == '}') {
+          break;
+        }
+        if(c != ',') {
+          _error("expected ',' or '}'");
+        }
+        _skip_space();
+      }
+      m_handler.end_object();
+    }
+
+    void _array() {
+      _expect('[');
+      m_handler.begin_array();
+      _skip_space();
+      if(_peek() == ']') {
+        _get();
+        m_handler.end_array();
+        return;
+      }
+      while(true) {
+        _value();
+        _skip_space();
+        int c = _get();
+        if(c == ']') {
+          break;
+        }
+        if(c != ',') {
+          _error("expected ',' or ']'");
+        }
+        _skip_space();
+      }
+      m_handler.end_array();
+    }
+
+    static int _hex(int c) {
+      if(c >= '0' && c <= '9') return c - '0';
+      if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+      if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+      return 0;
+    }
+
+    int _hex_value(int n_digits) {
+      int result = 0;
+      for(int i = 0; i < n_digits; i++) {
+        int c = _get();
+        if(c == eof()) {
+          _error("unterminated string");
+        }
+        result = (result << 4) + _hex(c);
+      }
+      return result;
+    }
+
+    void _string(std::string &str) {
+      str.clear();
+      _expect('"');
+      while(true) {
+        int c = _get();
+        if(c == eof()) {
+          _error("unterminated string");
+        }
+        if(c == '"') {
+          return;
+        }
+        if(c != '\\') {
+          str += char(c);
+          continue;
+        }
+        c = _get();
+        switch(c) {
+        case 't':
+          str += '\t';
+          break;
+        case 'b':
+          str += '\b';
+          break;
+        case 'f':
+          str += '\f';
+          break;
+        case 'n':
+          str += '\n';
+          break;
+        case 'r':
+          str += '\r';
+          break;
+        case '\\':
+          str += '\\';
+          break;
+        case '/':
+          str += '/';
+          break;
+        case '"':
+          str += '"';
+          break;
+        case 'x':
+          str += char(_hex_value(2));
+          break;
+        case 'u':
+          str += char(_hex_value(4));
+          break;
+        default:
+          _error("invalid escape sequence");
+        }
+      }
+    }
+
+    void _number() {
+      m_str.clear();
+      bool is_real = false;
+      int c;
+      while((c = _peek()) != eof() &&
+            ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) {
+        if(c == '.' || c == 'e' || c == 'E') {
+          is_real = true;
+        }
+        m_str += char(_get());
+      }
+
+      const char *begin = m_str.c_str();
+      char *end;
+      errno = 0;
+      if(!is_real) {
+        long long i = std::strtoll(begin, &end, 10);
+        if(*end == 0 && errno == 0) {
+          m_handler.int_value(boost::int64_t(i));
+          return;
+        }
+        if(m_str[0] != '-') {
+          errno = 0;
+          unsigned long long u = std::strtoull(begin, &end, 10);
+          if(*end == 0 && errno == 0) {
+            m_handler.uint_value(boost::uint64_t(u));
+            return;
+          }
+        }
+      }
+      // strtod would depend on the decimal point of the C locale
+      double d;
+      m_real_stream.clear();
+      m_real_stream.str(m_str);
+      if(!(m_real_stream >> d) || m_real_stream.peek() != eof()) {
+        _error("invalid number '" + m_str + "'");
+      }
+      m_handler.real_value(d);
+    }
+
+    std::streambuf *m_buf;
+
+    Handler &m_handler;
+
+    /// Buffer for strings and numbers
+    std::string m_str;
+
+    /// Converts reals using the classic locale
+    std::istringstream m_real_stream;
+
+  };
+
+  /// \brief Read JSON from a stream, calling 'handler' for each value
+  ///
+  /// \relates jsonStreamReader
+  template<typename Handler>
+  void read_json_stream(std::istream &stream, Handler &handler) {
+    jsonStreamReader<Handler>(stream, handler).read();
+  }
+
+}
+
+#endif
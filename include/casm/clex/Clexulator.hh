@@ -295,23 +295,24 @@ namespace CASM {
       // Use the factory to construct the clexulator and store it in m_clex
       m_clex.reset(factory());
 
-      // Check nlist has the right weight_matrix
-      if(nlist.weight_matrix() != m_clex->weight_matrix()) {
-        std::cerr << "Error in Clexulator constructor: weight matrix of neighbor "
-                  "list does not match the weight matrix used to print the "
-                  "clexulator." << std::endl;
-        std::cerr << "nlist weight matrix: \n" << nlist.weight_matrix() << std::endl;
-        std::cerr << "clexulator weight matrix: \n" << m_clex->weight_matrix() << std::endl;
-        throw std::runtime_error(
-          "Error in Clexulator constructor: weight matrix of neighbor list does "
-          "not match the weight matrix used to print the clexulator. Try 'casm bset -uf'.");
-      }
-
-      // Expand the given neighbor list as necessary
-      nlist.expand(neighborhood().begin(), neighborhood().end());
+      _init_nlist(nlist);
 
     }
 
+    /// \brief Construct a Clexulator from tables of basis function data
+    ///
+    /// \param name Class name for the Clexulator, typically 'X_Clexulator'
+    /// \param data Basis function data, as written by write_clexulator_data
+    /// \param nlist, A PrimNeighborList to be updated to include the neighborhood
+    ///        of this Clexulator
+    ///
+    /// The basis functions are evaluated by Clexulator_impl::DataClexulator
+    /// rather than by a compiled library, so no compilation is necessary.
+    ///
+    Clexulator(std::string name,
+               const jsonParser &data,
+               PrimNeighborList &nlist);
+
 
     /// \brief Copy constructor
     Clexulator(const Clexulator &B) :
@@ -351,9 +352,9 @@ namespace CASM {
       swap(first.m_lib, second.m_lib);
     }
 
-    /// \brief Is runtime library loaded?
+    /// \brief Is runtime library or data loaded?
     bool initialized() const {
-      return m_lib.get() != nullptr;
+      return m_clex.get() != nullptr;
     }
 
     /// \brief Name
@@ -538,6 +539,25 @@ namespace CASM {
 
   private:
 
+    /// \brief Check the weight matrix and expand the neighbor list
+    void _init_nlist(PrimNeighborList &nlist) {
+
+      // Check nlist has the right weight_matrix
+      if(nlist.weight_matrix() != m_clex->weight_matrix()) {
+        std::cerr << "Error in Clexulator constructor: weight matrix of neighbor "
+                  "list does not match the weight matrix used to print the "
+                  "clexulator." << std::endl;
+        std::cerr << "nlist weight matrix: \n" << nlist.weight_matrix() << std::endl;
+        std::cerr << "clexulator weight matrix: \n" << m_clex->weight_matrix() << std::endl;
+        throw std::runtime_error(
+          "Error in Clexulator constructor: weight matrix of neighbor list does "
+          "not match the weight matrix used to print the clexulator. Try 'casm bset -uf'.");
+      }
+
+      // Expand the given neighbor list as necessary
+      nlist.expand(neighborhood().begin(), neighborhood().end());
+    }
+
     std::string m_name;
     std::unique_ptr<Clexulator_impl::Base> m_clex;
     std::shared_ptr<RuntimeLibrary> m_lib;
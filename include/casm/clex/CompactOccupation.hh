@@ -0,0 +1,110 @@
+#ifndef CASM_CompactOccupation_HH
+#define CASM_CompactOccupation_HH
+
+#include <memory>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include "casm/container/Array.hh"
+
+namespace CASM {
+
+  class Supercell;
+
+  /// \brief Occupation variables stored with the minimum number of bits per site
+  ///
+  /// - Sites are ordered as in ConfigDoF, so site 'l' is on sublattice l / volume
+  /// - Sites on a sublattice with N allowed occupants use ceil(log2(N)) bits,
+  ///   rounded up to a power of two, and each sublattice starts at a multiple
+  ///   of its field width, so that no site spans two words. A binary
+  ///   sublattice uses 1 bit per site, and a sublattice with only one allowed
+  ///   occupant uses none.
+  /// - Copies share the bit layout, so storing many snapshots of the same
+  ///   supercell costs only the packed occupation
+  ///
+  /// \ingroup Configuration
+  ///
+  class CompactOccupation {
+
+  public:
+
+    typedef boost::uint64_t word_type;
+
+    /// \brief Construct empty
+    CompactOccupation() {}
+
+    /// \brief Construct with all occupants 0
+    ///
+    /// \param sublat_n_occupants Number of allowed occupants on each sublattice
+    /// \param volume Number of sites per sublattice
+    ///
+    CompactOccupation(const std::vector<int> &sublat_n_occupants, Index volume);
+
+    /// \brief Construct with all occupants 0, using the allowed occupants of a Supercell
+    explicit CompactOccupation(const Supercell &scel);
+
+    /// \brief Number of sites
+    Index size() const {
+      return m_layout ? m_layout->size : 0;
+    }
+
+    /// \brief Occupant of site 'l'
+    int occ(Index l) const {
+      Index b = l / m_layout->volume;
+      const Index bit = m_layout->offset[b] + (l - b * m_layout->volume) * m_layout->bits[b];
+      return int((m_data[bit / word_bits] >> (bit % word_bits)) & m_layout->mask[b]);
+    }
+
+    /// \brief Set occupant of site 'l'
+    void set_occ(Index l, int val) {
+      Index b = l / m_layout->volume;
+      const Index bit = m_layout->offset[b] + (l - b * m_layout->volume) * m_layout->bits[b];
+      word_type &word = m_data[bit / word_bits];
+      const int shift = bit % word_bits;
+      word = (word & ~(m_layout->mask[b] << shift)) | ((word_type(val) & m_layout->mask[b]) << shift);
+    }
+
+    /// \brief Unpacked occupation, as stored by ConfigDoF
+    ReturnArray<int> occupation() const;
+
+    /// \brief Pack an occupation, as stored by ConfigDoF
+    void set_occupation(const Array<int> &_occupation);
+
+    /// \brief Number of bytes used to store the packed occupation
+    Index bytes() const {
+      return m_data.size() * sizeof(word_type);
+    }
+
+    bool operator==(const CompactOccupation &B) const {
+      return size() == B.size() && m_data == B.m_data;
+    }
+
+    bool operator!=(const CompactOccupation &B) const {
+      return !(*this == B);
+    }
+
+  private:
+
+    static const int word_bits = 64;
+
+    struct Layout {
+
+      Index volume;
+
+      Index size;
+
+      // for each sublattice: bits per site, offset of the first site, and bit mask
+      std::vector<int> bits;
+      std::vector<Index> offset;
+      std::vector<word_type> mask;
+
+    };
+
+    std::shared_ptr<const Layout> m_layout;
+
+    std::vector<word_type> m_data;
+
+  };
+
+}
+
+#endif
@@ -189,6 +189,13 @@ namespace CASM {
   /// \brief Returns correlations using 'clexulator'. Supercell needs a correctly populated neighbor list.
   Eigen::VectorXd correlations_vec(const ConfigDoF &configdof, const Supercell &scel, Clexulator &clexulator);
 
+  /// \brief Returns correlations using 'clexulator', by updating the correlations of a reference ConfigDoF
+  Correlation correlations(const ConfigDoF &configdof,
+                           const ConfigDoF &ref_configdof,
+                           const Correlation &ref_corr,
+                           const Supercell &scel,
+                           Clexulator &clexulator);
+
   /// \brief Returns num_each_molecule[ molecule_type], where 'molecule_type' is ordered as Structure::get_struc_molecule()
   ReturnArray<int> get_num_each_molecule(const ConfigDoF &configdof, const Supercell &scel);
 
@@ -0,0 +1,184 @@
+#ifndef CASM_ConfigEnumGroundState
+#define CASM_ConfigEnumGroundState
+
+#include "casm/container/InputEnumerator.hh"
+#include "casm/clex/Configuration.hh"
+#include "casm/clex/Clexulator.hh"
+#include "casm/clex/ECIContainer.hh"
+#include "casm/casm_io/Log.hh"
+#include "casm/misc/cloneable_ptr.hh"
+
+extern "C" {
+  CASM::EnumInterfaceBase *make_ConfigEnumGroundState_interface();
+}
+
+namespace CASM {
+
+  /// \brief Find the cluster expansion ground state in a particular Supercell
+  ///
+  /// - Minimizes the extensive potential energy:
+  ///   \code
+  ///   Omega = sum_l eci * corr_contribution(l) - sum_i chem_pot(occupant(i))
+  ///   \endcode
+  ///   over all occupations of the Supercell using depth-first branch-and-bound
+  /// - The energy is decomposed into terms, one per unit cell and group of
+  ///   basis functions sharing a neighborhood. Each term is bounded from below
+  ///   by its exact minimum over all completions of the unassigned sites in its
+  ///   neighborhood when that is cheap to evaluate, or otherwise by its
+  ///   unconstrained minimum, which is calculated once per Supercell
+  /// - If the search completes within the node and time limits the result is
+  ///   provably optimal; otherwise it is the best configuration found
+  /// - Enumerates a single Configuration, the ground state
+  ///
+  /// \ingroup ConfigEnumGroup
+  ///
+  class ConfigEnumGroundState : public InputEnumeratorBase<Configuration> {
+
+    // -- Required members -------------------
+
+  public:
+
+    /// \brief Construct with a Supercell, Clexulator, and ECI
+    ConfigEnumGroundState(
+      Supercell &_scel,
+      const Clexulator &_clexulator,
+      const ECIContainer &_eci,
+      const Eigen::VectorXd &_chem_pot,
+      double _max_time,
+      Index _max_nodes,
+      Index _max_term_size);
+
+    std::string name() const override {
+      return enumerator_name;
+    }
+
+    /// \brief Includes the search results in the source
+    jsonParser source(step_type step) const override;
+
+    static const std::string enumerator_name;
+    static const std::string interface_help;
+    static int run(PrimClex &primclex, const jsonParser &kwargs, const Completer::EnumOption &enum_opt);
+
+
+    // -- Unique -------------------
+
+    /// \brief True if the search completed and the result is the ground state
+    bool is_optimal() const {
+      return m_is_optimal;
+    }
+
+    /// \brief Potential energy of the result, per unit cell
+    double potential_energy() const;
+
+    /// \brief Number of search tree nodes visited
+    Index n_nodes() const {
+      return m_n_nodes;
+    }
+
+  private:
+
+    /// Implements increment
+    void increment() override;
+
+    /// \brief A group of basis functions that depend on the same sites
+    struct TermGroup {
+
+      /// Correlation indices
+      std::vector<Clexulator::size_type> corr_ind;
+
+      /// ECI for each correlation index
+      std::vector<double> eci;
+
+      /// Unconstrained minimum value of one term of this group
+      double min_value;
+    };
+
+    /// \brief The contribution from one TermGroup in one unit cell
+    struct Term {
+
+      Index unitcell;
+
+      Index group;
+
+      /// Linear indices of the distinct sites the term depends on
+      std::vector<Index> site;
+
+      /// Number of sites still unassigned
+      Index n_unassigned;
+
+      /// Current lower bound (exact value once n_unassigned == 0)
+      double bound;
+    };
+
+    /// \brief Construct TermGroup and Term, and the per site data
+    void _init_terms(const ECIContainer &_eci, const Eigen::VectorXd &_chem_pot);
+
+    /// \brief Evaluate a term using the current occupation
+    double _term_value(const Term &term);
+
+    /// \brief Minimum of a term over all occupations of the sites in the range
+    double _term_min(const Term &term, const std::vector<Index> &free);
+
+    /// \brief Lower bound of a term given the currently assigned sites
+    double _term_bound(const Term &term);
+
+    /// \brief Assign a site, updating the bound
+    void _assign(Index depth, int occ);
+
+    /// \brief Unassign a site, restoring the previous bound
+    void _unassign(Index depth);
+
+    /// \brief Depth-first branch-and-bound
+    void _search(Index depth);
+
+    /// \brief True if the node or time limit was exceeded
+    bool _limit_exceeded();
+
+    Supercell *m_scel;
+    Clexulator m_clexulator;
+
+    Index m_max_nodes;
+    double m_max_time;
+    Index m_max_term_size;
+    boost::chrono::steady_clock::time_point m_start_time;
+
+    std::vector<TermGroup> m_group;
+    std::vector<Term> m_term;
+
+    /// Order in which sites are assigned
+    std::vector<Index> m_order;
+
+    /// m_site_term[l]: indices of terms depending on site l
+    std::vector<std::vector<Index> > m_site_term;
+
+    /// m_site_pot[l][occ]: -chem_pot of occupant 'occ' at site l
+    std::vector<std::vector<double> > m_site_pot;
+
+    /// m_site_min_pot[l]: minimum of m_site_pot[l]
+    std::vector<double> m_site_min_pot;
+
+    /// m_assigned[l]: true if site l is assigned
+    std::vector<bool> m_assigned;
+
+    /// Saved bounds, restored on unassign: m_undo[depth] = [(term index, bound), ...]
+    std::vector<std::vector<std::pair<Index, double> > > m_undo;
+
+    /// Working occupation, pointed to by m_clexulator
+    Array<int> m_occ;
+
+    /// Working correlation contribution
+    std::vector<double> m_tcorr;
+
+    double m_bound;
+    double m_best_value;
+    Array<int> m_best_occ;
+    Index m_n_nodes;
+    bool m_is_optimal;
+    bool m_stop;
+
+    notstd::cloneable_ptr<Configuration> m_current;
+  };
+
+}
+
+#endif
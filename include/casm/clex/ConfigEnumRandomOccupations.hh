@@ -5,13 +5,12 @@
 #include "casm/container/InputEnumerator.hh"
 #include "casm/clex/Configuration.hh"
 #include "casm/misc/cloneable_ptr.hh"
+#include <functional>
 
 extern "C" {
   CASM::EnumInterfaceBase *make_ConfigEnumRandomOccupations_interface();
 }
 
-class MTRand;
-
 namespace CASM {
 
   /** \defgroup ConfigEnumGroup Configuration Enumerators
@@ -30,10 +29,17 @@ namespace CASM {
   public:
 
     /// \brief Construct with a Supercell, using all permutations
+    ///
+    /// - RandomGenerator may be MTRand or PhiloxRand, or any type with
+    ///   'randInt(n)' returning an integer in [0, n]
+    template<typename RandomGenerator>
     ConfigEnumRandomOccupations(
       Supercell &_scel,
       Index _n_config,
-      MTRand &_mtrand);
+      RandomGenerator &_random) :
+      ConfigEnumRandomOccupations(_scel, _n_config, [&_random](int max) {
+      return int(_random.randInt(max));
+    }) {}
 
     std::string name() const override {
       return enumerator_name;
@@ -45,6 +51,11 @@ namespace CASM {
 
   private:
 
+    /// \brief Construct with a function returning a random occupant index in [0, max]
+    ConfigEnumRandomOccupations(
+      Supercell &_scel,
+      Index _n_config,
+      std::function<int (int)> _random_occ);
 
     /// Implements increment
     void increment() override;
@@ -54,7 +65,7 @@ namespace CASM {
     void randomize();
 
     Index m_n_config;
-    MTRand *m_mtrand;
+    std::function<int (int)> m_random_occ;
     Array<int> m_max_allowed;
     notstd::cloneable_ptr<Configuration> m_current;
   };
@@ -5,6 +5,7 @@
 #include "casm/strain/StrainConverter.hh"
 #include "casm/container/InputEnumerator.hh"
 #include "casm/container/Counter.hh"
+#include "casm/misc/SobolSequence.hh"
 #include "casm/clex/Configuration.hh"
 
 extern "C" {
@@ -15,6 +16,10 @@ namespace CASM {
 
   /// Enumerate strained Configurations
   ///
+  /// - Strains are enumerated in the irreducible wedges of strain space, on a grid
+  ///   or, if 'sobol_samples' > 0, at the points of a Sobol sequence
+  /// - Only strains within the ellipsoid defined by 'magnitudes' are enumerated
+  ///
   /// \ingroup ConfigEnumGroup
   ///
   class ConfigEnumStrain : public InputEnumeratorBase<Configuration> {
@@ -27,7 +32,8 @@ namespace CASM {
                      const Configuration &_init,
                      const std::vector<Index> &subspace_partitions,
                      const std::vector<double> &magnitudes,
-                     std::string _mode);
+                     std::string _mode,
+                     Index sobol_samples = 0);
 
     std::string name() const override {
       return enumerator_name;
@@ -45,15 +51,39 @@ namespace CASM {
 
     // -- Unique -------------------
 
+    /// Set m_point to the first point for the current transformation matrix
+    void _first_point();
+
+    /// Set m_point to the next point for the current transformation matrix, return false if none
+    bool _next_point();
+
+    /// Check if m_point is within the strain ellipsoid
+    bool _in_range() const;
+
+    /// Advance until m_point is within the strain ellipsoid, return false if no more points
+    bool _find_valid();
+
     Configuration m_current;
 
     // counts over strain grid
     EigenCounter<Eigen::VectorXd> m_counter;
+
+    // number of Sobol points per transformation matrix, or 0 to use m_counter
+    Index m_sobol_samples;
+    SobolSequence m_sobol;
+    // Sobol points are scaled to [m_lower, m_lower + m_range)
+    Eigen::VectorXd m_lower;
+    Eigen::VectorXd m_range;
+
+    // current point, in the coordinates of m_trans_mats[m_equiv_ind]
+    Eigen::VectorXd m_point;
     // counts over transformation matrices
     Index m_equiv_ind;
     StrainConverter m_strain_calc;
     //set of non-equivalent transformation matrices matrices that, along with m_counter define irreducible space
     std::vector<Eigen::MatrixXd> m_trans_mats;
+    //strain is in range if m_point.dot(m_shape_mats[m_equiv_ind] * m_point) <= 1.0 + TOL
+    std::vector<Eigen::MatrixXd> m_shape_mats;
     PermuteIterator m_perm_begin, m_perm_end;
     Eigen::MatrixXd m_shape_factor;
 
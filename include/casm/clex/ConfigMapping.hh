@@ -30,7 +30,9 @@ namespace CASM {
       m_lattice_weight(0.5),
       m_max_volume_change(0.5),
       m_min_va_frac(0.),
-      m_max_va_frac(1.) {
+      m_max_va_frac(1.),
+      m_max_threads(1),
+      m_lattice_cache_loaded(false) {
     }
 
     ///\brief Construct and initialize a ConfigMapper
@@ -99,6 +101,19 @@ namespace CASM {
       m_max_va_frac = min(_max_va, 1.);
     }
 
+    /// \brief Maximum number of threads used to evaluate candidate lattices
+    Index max_threads() const {
+      return m_max_threads;
+    }
+
+    /// \brief Set the maximum number of threads used to evaluate candidate lattices
+    ///
+    /// - The default is the number of hardware threads
+    /// - The mapping found does not depend on the number of threads
+    void set_max_threads(Index _max_threads) {
+      m_max_threads = max(_max_threads, Index(1));
+    }
+
 
     ///\brief imports structure specified by 'pos_path' into primclex() by finding optimal mapping
     ///       and then setting displacements and strain to zero (only the mapped occupation is preserved)
@@ -265,6 +280,13 @@ namespace CASM {
                                                 Eigen::Matrix3d &cart_op) const;
 
   private:
+
+    /// \brief Cost of the best mapping found so far, shared by all threads
+    struct SharedBound;
+
+    /// \brief A mapping of a structure onto a particular lattice
+    struct LatticeMapping;
+
     PrimClex *m_pclex;
     mutable std::map<Index, std::vector<Lattice> > m_superlat_map;
     double m_lattice_weight;
@@ -273,8 +295,27 @@ namespace CASM {
     double m_max_va_frac;
     bool m_robust_flag, m_strict_flag, m_rotate_flag;
     double m_tol;
+    Index m_max_threads;
+    mutable bool m_lattice_cache_loaded;
     std::vector<std::pair<std::string, Index> > m_fixed_components;
     const std::vector<Lattice> &_lattices_of_vol(Index prim_vol) const;
+
+    /// \brief Add the lattices in the lattice enumeration cache to m_superlat_map
+    void _read_lattice_cache() const;
+
+    /// \brief Write the lattices in m_superlat_map to the lattice enumeration cache
+    void _write_lattice_cache() const;
+
+    /// \brief Find mappings of struc onto imposed_lat that may be within m_tol of the best mapping
+    ///
+    /// - Appends, in the order they are found, the mappings that cost less than all
+    ///   mappings of imposed_lat found before them, skipping any that cost at least
+    ///   m_tol more than the best mapping found by any thread
+    /// - Returns false if struc is incompatible with imposed_lat
+    bool _lattice_mappings(const BasicStructure<Site> &struc,
+                           const Lattice &imposed_lat,
+                           SharedBound &bound,
+                           std::vector<LatticeMapping> &mappings) const;
   };
 
   namespace ConfigMap_impl {
@@ -0,0 +1,109 @@
+#ifndef CASM_DataClexulator
+#define CASM_DataClexulator
+
+#include <vector>
+
+#include "casm/clex/Clexulator.hh"
+
+namespace CASM {
+
+  class jsonParser;
+
+  namespace Clexulator_impl {
+
+    /// \brief Evaluates occupation basis functions from tables
+    ///
+    /// - Each basis function is stored as a sum of terms, each a coefficient
+    ///   times a product of site basis functions evaluated at neighbor list sites
+    /// - The tables are read from the data written by write_clexulator_data, so
+    ///   that changing the basis set does not require compiling a Clexulator
+    /// - Evaluation is generally slower than a compiled Clexulator
+    ///
+    /// \ingroup ClexClex
+    ///
+    class DataClexulator : public Base {
+
+    public:
+
+      /// \brief Construct from data written by write_clexulator_data
+      explicit DataClexulator(const jsonParser &json);
+
+      /// \brief Calculate contribution to global correlations from one unit cell
+      void calc_global_corr_contribution(double *corr_begin) const override;
+
+      /// \brief Calculate contribution to select global correlations from one unit cell
+      void calc_restricted_global_corr_contribution(double *corr_begin, size_type const *ind_list_begin, size_type const *ind_list_end) const override;
+
+      /// \brief Calculate point correlations about basis site 'b_index'
+      void calc_point_corr(int b_index, double *corr_begin) const override;
+
+      /// \brief Calculate select point correlations about basis site 'b_index'
+      void calc_restricted_point_corr(int b_index, double *corr_begin, size_type const *ind_list_begin, size_type const *ind_list_end) const override;
+
+      /// \brief Calculate the change in point correlations due to changing an occupant
+      void calc_delta_point_corr(int b_index, int occ_i, int occ_f, double *corr_begin) const override;
+
+      /// \brief Calculate the change in select point correlations due to changing an occupant
+      void calc_restricted_delta_point_corr(int b_index,
+                                            int occ_i,
+                                            int occ_f,
+                                            double *corr_begin,
+                                            size_type const *ind_list_begin,
+                                            size_type const *ind_list_end) const override;
+
+    private:
+
+      /// \brief Clone the DataClexulator
+      Base *_clone() const override {
+        return new DataClexulator(*this);
+      }
+
+      /// \brief Terms of a set of basis functions
+      ///
+      /// - Terms of function 'i' are in the range [function_begin[i], function_begin[i+1])
+      /// - Factors of term 't' are in the range [term_begin[t], term_begin[t+1])
+      /// - Factor 'k' is m_occ_func[occ_func[k] + occupation of neighbor list site nlist_ind[k]]
+      struct FunctionTable {
+
+        std::vector<size_type> function_begin;
+
+        std::vector<double> coeff;
+
+        std::vector<size_type> term_begin;
+
+        std::vector<size_type> nlist_ind;
+
+        std::vector<size_type> occ_func;
+
+      };
+
+      /// \brief Read a FunctionTable
+      FunctionTable _read_table(const jsonParser &json) const;
+
+      /// \brief Evaluate function 'i'
+      double _eval(const FunctionTable &table, size_type i) const;
+
+      /// \brief Evaluate the change in function 'i' due to changing the occupant at neighbor list site 'center'
+      double _eval_delta(const FunctionTable &table, size_type i, size_type center, int occ_i, int occ_f) const;
+
+      /// \brief Site basis function values, for each sublattice, function, and occupant
+      std::vector<double> m_occ_func;
+
+      /// \brief m_occ_func_begin[b][f]: index into m_occ_func of function 'f' on sublattice 'b'
+      std::vector<std::vector<size_type> > m_occ_func_begin;
+
+      /// \brief Basis functions, for calculating global correlations
+      FunctionTable m_orbit_func;
+
+      /// \brief Basis functions about each basis site, for calculating point correlations
+      std::vector<FunctionTable> m_flower_func;
+
+      /// \brief Neighbor list index of each basis site
+      std::vector<size_type> m_flower_nlist_ind;
+
+    };
+
+  }
+}
+
+#endif
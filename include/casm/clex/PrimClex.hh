@@ -359,5 +359,12 @@ namespace CASM {
                         std::ostream &stream,
                         double xtal_tol);
 
+  /// \brief Write basis function data, for constructing a Clexulator without compilation
+  void write_clexulator_data(const Structure &prim,
+                             SiteOrbitree &tree,
+                             const PrimNeighborList &nlist,
+                             jsonParser &json,
+                             double xtal_tol);
+
 }
 #endif
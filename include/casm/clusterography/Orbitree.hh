@@ -297,6 +297,33 @@ namespace CASM {
     return result;
   }
 
+  /// \brief Sorted UnitCellCoord of the sites of a cluster, translated so that
+  /// the first is in the origin UnitCell
+  ///
+  /// \param clust the cluster
+  /// \param struc the structure that UnitCellCoord are referenced to
+  /// \param tol tolerance for mapping Coordinate to UnitCellCoord
+  ///
+  /// Two clusters are equivalent by lattice translation if and only if their
+  /// keys are equal. Throws if a site of 'clust' is not a site of 'struc'.
+  ///
+  template<typename ClustType, typename StrucType>
+  std::vector<UnitCellCoord> translation_key(const ClustType &clust, const StrucType &struc, double tol) {
+    std::vector<UnitCellCoord> key;
+    key.reserve(clust.size());
+    for(int ns = 0; ns < clust.size(); ++ns) {
+      key.emplace_back(clust[ns], struc, tol);
+    }
+    std::sort(key.begin(), key.end());
+    if(key.size()) {
+      UnitCell origin = key[0].unitcell();
+      for(auto &uccoord : key) {
+        uccoord -= origin;
+      }
+    }
+    return key;
+  }
+
   /// \brief Iterate over all sites in an orbitree and insert a UnitCellCoord
   ///
   /// \param result an OutputIterator for UnitCellCoord
@@ -418,6 +418,34 @@ namespace CASM {
     at(0).push_back(GenericOrbit<ClustType>(ClustType(lattice)));
     at(0).back().get_equivalent(prim.factor_group(), tol());
 
+    // The translation_key of every cluster of every orbit, so that checking if
+    // a candidate cluster is new is a lookup rather than a comparison against
+    // all equivalent clusters. If any site can not be found in 'prim', fall
+    // back to 'contains'
+    std::set<std::vector<UnitCellCoord> > orbit_keys;
+    bool use_keys = true;
+    auto insert_keys = [&](const GenericOrbit<ClustType> &new_orbit) {
+      try {
+        for(Index ne = 0; ne < new_orbit.size(); ne++) {
+          orbit_keys.insert(translation_key(new_orbit[ne], prim, tol()));
+        }
+      }
+      catch(std::runtime_error &e) {
+        use_keys = false;
+      }
+    };
+    auto is_new = [&](const ClustType & test_clust) {
+      if(use_keys) {
+        try {
+          return !orbit_keys.count(translation_key(test_clust, prim, tol()));
+        }
+        catch(std::runtime_error &e) {
+          use_keys = false;
+        }
+      }
+      return !contains(test_clust);
+    };
+    insert_keys(at(0).back());
 
     //for each cluster of the previous size, add points from gridstruc
     //   - see if the new cluster satisfies the size requirements
@@ -456,14 +484,16 @@ namespace CASM {
           tclust.within();
           tclust.calc_properties();
 
-          if(np == 1 && !contains(tclust)) {
+          if(np == 1 && is_new(tclust)) {
             at(np).push_back(GenericOrbit<ClustType>(tclust));
             at(np).back().get_equivalent(prim.factor_group(), tol());
+            insert_keys(at(np).back());
           }
-          else if(tclust.max_length() < max_length[np] && tclust.min_length() > min_length && !contains(tclust)) {
+          else if(tclust.max_length() < max_length[np] && tclust.min_length() > min_length && is_new(tclust)) {
             at(np).push_back(GenericOrbit<ClustType>(tclust));
 
             at(np).back().get_equivalent(prim.factor_group(), tol());
+            insert_keys(at(np).back());
           }
           tclust.pop_back();
         }
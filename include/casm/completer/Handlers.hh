@@ -657,6 +657,28 @@ namespace CASM {
 
     //*****************************************************************************************************//
 
+    /**
+     * Options set for `casm server`. Keep your project loaded here.
+     */
+
+    class ServerOption : public OptionHandlerBase {
+
+    public:
+
+      ServerOption();
+
+      const fs::path &socket_path() const;
+
+    private:
+
+      void initialize() override;
+
+      fs::path m_socket_path;
+
+    };
+
+    //*****************************************************************************************************//
+
     /**
      * Options set for `casm super`. Get your superstructures here.
      */
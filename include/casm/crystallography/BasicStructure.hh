@@ -46,6 +46,9 @@ namespace CASM {
 
     void main_print(std::ostream &stream, COORD_TYPE mode, bool version5, int option) const;
 
+    /// Partition basis sites into classes that factor group operations must preserve
+    std::vector<Index> _site_invariant_classes(double map_tol) const;
+
   public: // PUBLIC METHODS
 
     // ****Constructors****
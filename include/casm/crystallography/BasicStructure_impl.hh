@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -6,6 +7,7 @@
 #include "casm/crystallography/Coordinate.hh"
 #include "casm/crystallography/UnitCellCoord.hh"
 #include "casm/crystallography/PrimGrid.hh"
+#include "casm/crystallography/PeriodicCellList.hh"
 #include "casm/symmetry/SymPermutation.hh"
 #include "casm/symmetry/SymBasisPermute.hh"
 #include "casm/symmetry/SymGroupRep.hh"
@@ -99,6 +101,55 @@ namespace CASM {
 
   //***********************************************************
 
+  /// Sites are in the same class if they have the same type and the same sorted list of
+  /// distances to all basis sites. Factor group operations map each site onto a site of
+  /// the same class, which is used to limit the translations and site mappings checked in
+  /// generate_factor_group_slow.
+  ///
+  /// \returns class index of each basis site
+  template<typename CoordType>
+  std::vector<Index> BasicStructure<CoordType>::_site_invariant_classes(double map_tol) const {
+
+    std::vector<std::vector<double> > fingerprint(basis.size());
+    for(Index b0 = 0; b0 < basis.size(); b0++) {
+      for(Index b1 = 0; b1 < basis.size(); b1++) {
+        fingerprint[b0].push_back(basis[b0].robust_min_dist(basis[b1]));
+      }
+      std::sort(fingerprint[b0].begin(), fingerprint[b0].end());
+    }
+
+    // each site may be displaced by up to map_tol, so distances may differ by twice that
+    auto is_equiv = [&](Index b0, Index b1) {
+      if(!basis[b0].compare_type(basis[b1])) {
+        return false;
+      }
+      for(Index i = 0; i < basis.size(); i++) {
+        if(std::abs(fingerprint[b0][i] - fingerprint[b1][i]) > 2.0 * map_tol) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    std::vector<Index> site_class(basis.size());
+    std::vector<Index> prototype;
+    for(Index b0 = 0; b0 < basis.size(); b0++) {
+      Index c = 0;
+      for(; c < prototype.size(); c++) {
+        if(is_equiv(prototype[c], b0)) {
+          break;
+        }
+      }
+      if(c == prototype.size()) {
+        prototype.push_back(b0);
+      }
+      site_class[b0] = c;
+    }
+    return site_class;
+  }
+
+  //************************************************************
+
   template<typename CoordType>
   void BasicStructure<CoordType>::generate_factor_group_slow(SymGroup &factor_group, double map_tol) const {
     //std::cout << "SLOW GENERATION OF FACTOR GROUP " << &factor_group << "\n";
@@ -119,23 +170,44 @@ namespace CASM {
       factor_group.clear();
     }
     factor_group.set_lattice(lattice());
+
+    //Partition the basis sites into classes that must map onto each other, and
+    //only check translations that map the least-populated class onto itself
+    std::vector<Index> site_class = _site_invariant_classes(map_tol);
+    std::vector<std::vector<Index> > class_sites;
+    for(b0 = 0; b0 < basis.size(); b0++) {
+      if(site_class[b0] >= class_sites.size()) {
+        class_sites.resize(site_class[b0] + 1);
+      }
+      class_sites[site_class[b0]].push_back(b0);
+    }
+    Index ref_class = 0;
+    for(Index c = 0; c < class_sites.size(); c++) {
+      if(class_sites[c].size() < class_sites[ref_class].size()) {
+        ref_class = c;
+      }
+    }
+    Index ref_site = class_sites.size() ? class_sites[ref_class][0] : 0;
+
     //Loop over all point group ops of the lattice
     for(pg = 0; pg < point_group.size(); pg++) {
       trans_basis.clear();
       //First, generate the symmetrically transformed basis sites
       //Loop over all sites in basis
+      PeriodicCellList trans_cells(lattice(), map_tol, basis.size());
       for(b0 = 0; b0 < basis.size(); b0++) {
         trans_basis.push_back(point_group[pg]*basis[b0]);
+        trans_cells.insert(trans_basis.back());
       }
 
       //Using the symmetrically transformed basis, find all possible translations
       //that MIGHT map the symmetrically transformed basis onto the original basis
       for(b0 = 0; b0 < trans_basis.size(); b0++) {
 
-        if(!basis[0].compare_type(trans_basis[b0]))
+        if(site_class[b0] != ref_class)
           continue;
 
-        t_tau = basis[0] - trans_basis[b0];
+        t_tau = basis[ref_site] - trans_basis[b0];
 
         t_tau.within();
         num_suc_maps = 0; //Keeps track of number of old->new basis site mappings that are found
@@ -143,7 +215,14 @@ namespace CASM {
         double tdist = 0.0;
         double max_error = 0.0;
         for(b1 = 0; b1 < basis.size(); b1++) { //Loop over original basis sites
-          for(b2 = 0; b2 < trans_basis.size(); b2++) { //Loop over symmetrically transformed basis sites
+          //Only check symmetrically transformed basis sites of the same class, near basis[b1]
+          std::vector<Index> candidates = trans_cells.within(basis[b1].const_cart() - t_tau.const_cart(), map_tol);
+          Index i2 = 0;
+          for(; i2 < candidates.size(); i2++) {
+            b2 = candidates[i2];
+            if(site_class[b2] != site_class[b1]) {
+              continue;
+            }
 
             //see if translation successfully maps the two sites
             if(basis[b1].compare(trans_basis[b2], t_tau, map_tol)) {
@@ -157,7 +236,7 @@ namespace CASM {
           }
 
           //break out of outer loop if inner loop finds no successful map
-          if(b2 == trans_basis.size()) {
+          if(i2 == candidates.size()) {
             break;
           }
         }
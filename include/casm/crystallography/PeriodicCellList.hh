@@ -0,0 +1,101 @@
+#ifndef CASM_PeriodicCellList
+#define CASM_PeriodicCellList
+
+#include <vector>
+
+#include "casm/external/Eigen/Dense"
+#include "casm/CASM_global_definitions.hh"
+
+namespace CASM {
+
+  class Lattice;
+  class Coordinate;
+
+  /** \ingroup Lattice
+   *  @{
+   */
+
+  /// \brief Bins periodic coordinates for fast neighbor searches
+  ///
+  /// - Coordinates are binned on a grid commensurate with a Lattice. Searches for
+  ///   points within some radius of a query point only check the bins that can
+  ///   contain such points, including periodic images.
+  /// - Bins are at least 'cutoff' wide, and large enough to contain about one point
+  ///   each when 'expected_size' points are inserted. Searches with a radius
+  ///   larger than 'cutoff' remain correct, but check more bins.
+  /// - Indices returned by queries are the order in which points were inserted.
+  ///
+  class PeriodicCellList {
+
+  public:
+
+    /// \brief Construct an empty PeriodicCellList
+    PeriodicCellList(const Lattice &lat, double cutoff, Index expected_size = 1);
+
+    /// \brief Number of points inserted
+    Index size() const {
+      return m_frac.size();
+    }
+
+    /// \brief Insert a point, given as a Coordinate, and return its index
+    Index insert(const Coordinate &coord);
+
+    /// \brief Insert a point, given in Cartesian coordinates, and return its index
+    Index insert(const Eigen::Ref<const Eigen::Vector3d> &cart);
+
+    /// \brief Insert points, given as columns of Cartesian coordinates
+    void insert_cols(const Eigen::Ref<const Eigen::MatrixXd> &cart);
+
+    /// \brief Indices of points within 'radius' of any periodic image of 'cart'
+    std::vector<Index> within(const Eigen::Ref<const Eigen::Vector3d> &cart, double radius) const;
+
+    /// \brief Indices of points within 'radius' of any periodic image of 'coord'
+    std::vector<Index> within(const Coordinate &coord, double radius) const;
+
+    /// \brief Index of the nearest point within 'radius' of any periodic image of 'cart', or size() if none
+    Index nearest(const Eigen::Ref<const Eigen::Vector3d> &cart, double radius) const;
+
+    /// \brief Index of the nearest point within 'radius' of any periodic image of 'coord', or size() if none
+    Index nearest(const Coordinate &coord, double radius) const;
+
+    /// \brief Index of the nearest point to each column of Cartesian coordinates, or size() if none
+    std::vector<Index> nearest_cols(const Eigen::Ref<const Eigen::MatrixXd> &cart, double radius) const;
+
+  private:
+
+    /// \brief Call 'f(index, dist)' for each point within 'radius' of any periodic image of 'cart'
+    template<typename Function>
+    void _for_each_within(const Eigen::Ref<const Eigen::Vector3d> &cart, double radius, Function f) const;
+
+    /// \brief Bin containing fractional coordinate 'frac', which should be within [0, 1)
+    Eigen::Vector3l _bin(const Eigen::Vector3d &frac) const;
+
+    /// \brief Linear index of a bin
+    Index _linear(const Eigen::Vector3l &bin) const {
+      return bin(0) + m_n(0) * (bin(1) + m_n(1) * bin(2));
+    }
+
+    /// \brief Lattice vectors, column-wise
+    Eigen::Matrix3d m_lat_column_mat;
+
+    /// \brief Inverse of m_lat_column_mat
+    Eigen::Matrix3d m_inv_lat_column_mat;
+
+    /// \brief Distance between lattice planes spanned by the other two lattice vectors
+    Eigen::Vector3d m_spacing;
+
+    /// \brief Number of bins along each lattice vector
+    Eigen::Vector3l m_n;
+
+    /// \brief Fractional coordinates of points, within [0, 1)
+    std::vector<Eigen::Vector3d> m_frac;
+
+    /// \brief Indices of points in each bin
+    std::vector<std::vector<Index> > m_bins;
+
+  };
+
+  /** @} */
+}
+
+#endif
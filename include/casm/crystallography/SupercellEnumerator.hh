@@ -1,6 +1,7 @@
 #ifndef SupercellEnumerator_HH
 #define SupercellEnumerator_HH
 
+#include <set>
 #include "casm/external/Eigen/Dense"
 
 #include "casm/misc/cloneable_ptr.hh"
@@ -238,6 +239,13 @@ namespace CASM {
 
     /// \brief Compare two integer matrices and see which one is lexicographically greatest. Returns true if H0<H1
     bool _canonical_compare(const Eigen::MatrixXi &H0, const Eigen::MatrixXi &H1);
+
+    /// \brief Strict weak ordering of 3x3 integer matrices, for use in std::set
+    struct MatrixLess {
+      bool operator()(const Eigen::Matrix3i &A, const Eigen::Matrix3i &B) const {
+        return std::lexicographical_compare(A.data(), A.data() + 9, B.data(), B.data() + 9);
+      }
+    };
   }
 
   //******************************************************************************************************************//
@@ -316,6 +324,9 @@ namespace CASM {
     /// \brief Update m_super when required
     void _update_super();
 
+    /// \brief Find the canonical form of the current supercell matrix and record its equivalents
+    void _canonicalize();
+
 
     /// \brief Indicates if m_super reflects the current m_current supercell matrix
     mutable bool m_super_updated;
@@ -329,8 +340,14 @@ namespace CASM {
     /// \brief A supercell, stored here so that iterator dereferencing will be OK. Only used when requested.
     mutable UnitType m_super;
 
+    /// \brief Canonical form of the current supercell matrix
+    Eigen::Matrix3i m_canon;
+
     /// \brief Keep track of the HNF matrices for the current determinant value
-    std::vector<Eigen::Matrix3i> m_canon_hist;
+    ///
+    /// - Includes all HNF matrices equivalent by point group operations to the ones already
+    ///   visited, so that equivalent supercells can be skipped without finding their canonical form
+    std::set<Eigen::Matrix3i, HermiteCounter_impl::MatrixLess> m_canon_hist;
 
   };
 
@@ -383,6 +400,9 @@ namespace CASM {
     /// \brief Access the unit point group
     const SymGroup &point_group() const;
 
+    /// \brief Access the unit point group operations, as integer matrices in fractional coordinates
+    const std::vector<Eigen::Matrix3i> &frac_point_group() const;
+
     /// \brief Set the beginning volume
     void begin_volume(size_type _begin_volume);
 
@@ -416,6 +436,9 @@ namespace CASM {
     /// \brief A const iterator to a specified volume
     const_iterator citerator(size_type volume) const;
 
+    /// \brief Number of symmetrically unique supercells of a specified volume
+    size_type count(size_type volume) const;
+
   private:
 
     /// \brief The unit cell of the supercells
@@ -427,6 +450,9 @@ namespace CASM {
     /// \brief The point group of the unit cell
     SymGroup m_point_group;         //factor group...?
 
+    /// \brief The point group of the unit cell, as integer matrices in fractional coordinates
+    std::vector<Eigen::Matrix3i> m_frac_point_group;
+
     /// \brief The first volume supercells to be iterated over (what cbegin uses)
     const int m_begin_volume;
 
@@ -484,6 +510,8 @@ namespace CASM {
     if(dims < 1) {
       throw std::runtime_error("Dimensions to count over must be greater than 0!");
     }
+
+    _canonicalize();
   }
 
   /*
@@ -500,13 +528,17 @@ namespace CASM {
     m_current = B.m_current;
     m_super_updated = false;
 
+    m_canon = B.m_canon;
     m_canon_hist = B.m_canon_hist;
     return *this;
   }
 
+  /// Iterators are equal if they point at the same HermiteCounter position. Iterators only
+  /// stop on the first position of each orbit of equivalent supercell matrices, so this
+  /// is equivalent to comparing canonical forms.
   template<typename UnitType>
   bool SupercellIterator<UnitType>::operator==(const SupercellIterator &B) const {
-    return (m_enum == B.m_enum) && (matrix() - B.matrix()).isZero();
+    return (m_enum == B.m_enum) && ((*m_current)() - (*B.m_current)()).isZero();
   }
 
   template<typename UnitType>
@@ -539,8 +571,7 @@ namespace CASM {
 
   template<typename UnitType>
   Eigen::Matrix3i SupercellIterator<UnitType>::matrix() const {
-    Eigen::Matrix3i expanded = HermiteCounter_impl::_expand_dims((*m_current)(), m_enum->gen_mat());
-    return canonical_hnf(expanded, m_enum->point_group(), m_enum->lattice());
+    return m_canon;
   }
 
   template<typename UnitType>
@@ -569,21 +600,46 @@ namespace CASM {
 
   template<typename UnitType>
   void SupercellIterator<UnitType>::_increment() {
-    m_canon_hist.push_back(matrix());
-    HermiteCounter::value_type last_determinant = m_current->determinant();
-    ++(*m_current);
-
-    if(last_determinant != m_current->determinant()) {
-      m_canon_hist.clear();
-    }
-
-    while(std::find(m_canon_hist.begin(), m_canon_hist.end(), matrix()) != m_canon_hist.end()) {
+    auto current_hnf = [&]() {
+      Eigen::Matrix3i expanded = HermiteCounter_impl::_expand_dims((*m_current)(), m_enum->gen_mat());
+      return Eigen::Matrix3i(hermite_normal_form(expanded).first);
+    };
+
+    // the equivalents of the current supercell matrix were recorded by _canonicalize, so
+    // skip any HNF matrix in m_canon_hist without finding its canonical form
+    do {
+      HermiteCounter::value_type last_determinant = m_current->determinant();
       ++(*m_current);
+
+      if(last_determinant != m_current->determinant()) {
+        m_canon_hist.clear();
+      }
     }
+    while(m_canon_hist.count(current_hnf()));
 
+    _canonicalize();
     m_super_updated = false;
   }
 
+  /// Finds the canonical form of the current supercell matrix, H, by applying each point group
+  /// operation, and inserts each resulting HNF matrix into m_canon_hist. Those are exactly the
+  /// supercell matrices equivalent to H, so each orbit is only canonicalized once.
+  template<typename UnitType>
+  void SupercellIterator<UnitType>::_canonicalize() {
+    Eigen::Matrix3i expanded = HermiteCounter_impl::_expand_dims((*m_current)(), m_enum->gen_mat());
+    const Eigen::Matrix3i H = hermite_normal_form(expanded).first;
+
+    m_canon = H;
+    m_canon_hist.insert(H);
+    for(const auto &op : m_enum->frac_point_group()) {
+      Eigen::Matrix3i H_transformed = hermite_normal_form(op * H).first;
+      if(m_canon_hist.insert(H_transformed).second &&
+         HermiteCounter_impl::_canonical_compare(m_canon, H_transformed)) {
+        m_canon = H_transformed;
+      }
+    }
+  }
+
   //********************************************************************************************************//
 
   template<typename UnitType>
@@ -601,6 +657,11 @@ namespace CASM {
     return m_point_group;
   }
 
+  template<typename UnitType>
+  const std::vector<Eigen::Matrix3i> &SupercellEnumerator<UnitType>::frac_point_group() const {
+    return m_frac_point_group;
+  }
+
   template<typename UnitType>
   const Eigen::Matrix3i &SupercellEnumerator<UnitType>::gen_mat() const {
     return m_gen_mat;
@@ -662,6 +723,18 @@ namespace CASM {
     return SupercellIterator<UnitType>(*this, volume, dimension());
   }
 
+  /// Counts the canonical supercell matrices of the volume, without constructing the
+  /// supercells themselves
+  template<typename UnitType>
+  typename SupercellEnumerator<UnitType>::size_type SupercellEnumerator<UnitType>::count(size_type volume) const {
+    size_type result = 0;
+    const_iterator end_it = citerator(volume + 1);
+    for(const_iterator it = citerator(volume); it != end_it; ++it) {
+      ++result;
+    }
+    return result;
+  }
+
 
   // declare specializations for Lattice
 
@@ -374,6 +374,10 @@ namespace CASM {
   // Finds optimal assignments, based on cost_matrix, and returns total optimal cost
   double hungarian_method(const Eigen::MatrixXd &cost_matrix, std::vector<Index> &optimal_assignments, const double _tol);
 
+  // Finds optimal assignments, based on non-negative cost_matrix, and returns total optimal cost.
+  // Stops early, leaving optimal_assignments empty, once the optimal cost is known to exceed 'max_cost'
+  double hungarian_method(const Eigen::MatrixXd &cost_matrix, std::vector<Index> &optimal_assignments, const double _tol, const double max_cost);
+
   namespace HungarianMethod_impl {
     // *******************************************************************************************
     /* Hungarian Algorithm Routines
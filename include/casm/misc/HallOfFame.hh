@@ -110,6 +110,11 @@ namespace CASM {
       return m_metric;
     }
 
+    /// \brief Calculate the score of an object, without inserting it
+    double score(const ObjectType &obj) {
+      return m_metric(obj);
+    }
+
     bool empty() const {
       return m_halloffame.empty();
     }
@@ -122,21 +127,38 @@ namespace CASM {
       return m_max_size;
     }
 
+    /// \brief Returns true if an object with 'score' would be kept in the HallOfFame
+    ///
+    /// - Objects with this score may still be rejected by 'insert' if they are already
+    ///   in the HallOfFame or are excluded
+    bool check_score(double score) const {
+      if(m_max_size <= 0) {
+        return false;
+      }
+      return m_halloffame.size() < m_max_size || !m_score_compare(m_halloffame.rbegin()->first, score);
+    }
+
     /// \brief Insert object in HallOfFame
     ///
     /// - Will score object, and insert into HallOfFame, erasing the worst scoring
     /// member if necessary to maintain the max_size specified at construction
     InsertResult insert(const ObjectType &obj) {
-
-      auto excluded_pos = m_exclude.end();
       if(m_max_size <= 0) {
-        return InsertResult(m_halloffame.end(), false, std::numeric_limits<double>::quiet_NaN(), false, excluded_pos);
+        return InsertResult(m_halloffame.end(), false, std::numeric_limits<double>::quiet_NaN(), false, m_exclude.end());
       }
+      return insert(obj, m_metric(obj));
+    }
 
-      double score = m_metric(obj);
+    /// \brief Insert object in HallOfFame, using a score already calculated
+    ///
+    /// - 'score' must equal metric()(obj), for example if it was calculated for an
+    ///   equivalent object before constructing 'obj'
+    InsertResult insert(const ObjectType &obj, double score) {
+
+      auto excluded_pos = m_exclude.end();
 
       // if score is not good enough for hall of fame, do not insert
-      if(m_halloffame.size() == m_max_size && m_score_compare(m_halloffame.rbegin()->first, score)) {
+      if(!check_score(score)) {
         return InsertResult(m_halloffame.end(), false, score, false, excluded_pos);
       }
 
@@ -0,0 +1,181 @@
+#ifndef CASM_PhiloxRand
+#define CASM_PhiloxRand
+
+#include <cmath>
+#include <boost/cstdint.hpp>
+
+namespace CASM {
+
+  class jsonParser;
+
+  /// \brief Counter-based random number generator (Philox4x32-10)
+  ///
+  /// Implements the Philox4x32-10 generator of:
+  ///   Salmon, Moraes, Dror, and Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3",
+  ///   Proceedings of SC11 (2011).
+  ///
+  /// - Each random number is a function of (seed, stream, position), so generators with
+  ///   the same seed and different streams give independent sequences, for example for
+  ///   independent Monte Carlo runs, and the state can be saved and restored exactly
+  ///   as three integers
+  /// - Has the same interface as MTRand for the functions used in CASM, so that either
+  ///   may be used as a template parameter where a random number generator is required
+  ///
+  class PhiloxRand {
+
+  public:
+
+    typedef boost::uint32_t uint32;
+    typedef boost::uint64_t uint64;
+
+    /// \brief Construct with seed and stream, starting at position 0
+    explicit PhiloxRand(uint64 _seed = 0, uint64 _stream = 0) {
+      seed(_seed, _stream);
+    }
+
+    /// \brief Reset with seed and stream, starting at position 0
+    void seed(uint64 _seed, uint64 _stream = 0) {
+      m_seed = _seed;
+      m_stream = _stream;
+      set_position(0);
+    }
+
+    /// \brief Seed
+    uint64 seed() const {
+      return m_seed;
+    }
+
+    /// \brief Stream
+    uint64 stream() const {
+      return m_stream;
+    }
+
+    /// \brief Number of 32-bit integers generated since seeding
+    uint64 position() const {
+      return m_position;
+    }
+
+    /// \brief Skip to the state after generating 'pos' 32-bit integers since seeding
+    void set_position(uint64 pos) {
+      m_position = pos;
+      if(pos % 4) {
+        _generate(pos / 4);
+      }
+    }
+
+    /// \brief Integer in [0, 2^32-1]
+    uint32 randInt() {
+      if(m_position % 4 == 0) {
+        _generate(m_position / 4);
+      }
+      return m_block[m_position++ % 4];
+    }
+
+    /// \brief Integer in [0, n] for n < 2^32
+    uint32 randInt(const uint32 n) {
+      uint32 used = n;
+      used |= used >> 1;
+      used |= used >> 2;
+      used |= used >> 4;
+      used |= used >> 8;
+      used |= used >> 16;
+
+      uint32 i;
+      do {
+        i = randInt() & used;
+      }
+      while(i > n);
+      return i;
+    }
+
+    /// \brief Real number in [0, 1]
+    double rand() {
+      return double(randInt()) * (1.0 / 4294967295.0);
+    }
+
+    /// \brief Real number in [0, n]
+    double rand(const double n) {
+      return rand() * n;
+    }
+
+    /// \brief Real number in [0, 1)
+    double randExc() {
+      return double(randInt()) * (1.0 / 4294967296.0);
+    }
+
+    /// \brief Real number in [0, n)
+    double randExc(const double n) {
+      return randExc() * n;
+    }
+
+    /// \brief Real number in [0, 1), with 53-bit resolution
+    double rand53() {
+      uint32 a = randInt() >> 5, b = randInt() >> 6;
+      return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+    }
+
+    /// \brief Fill a range with real numbers in [0, 1), with 53-bit resolution
+    ///
+    /// - Equivalent to calling rand53() for each element
+    template<typename Iterator>
+    void rand53(Iterator begin, Iterator end) {
+      for(; begin != end; ++begin) {
+        *begin = rand53();
+      }
+    }
+
+    /// \brief Real number from a normal distribution, using the Box-Muller method
+    double randNorm(const double mean = 0.0, const double stddev = 1.0) {
+      double r = std::sqrt(-2.0 * std::log(1.0 - rand53()));
+      double phi = 2.0 * M_PI * rand53();
+      return mean + stddev * r * std::cos(phi);
+    }
+
+  private:
+
+    /// \brief Generate the block of four 32-bit integers for counter (block_index, m_stream)
+    void _generate(uint64 block_index) {
+      uint32 ctr[4] = {
+        uint32(block_index), uint32(block_index >> 32),
+        uint32(m_stream), uint32(m_stream >> 32)
+      };
+      uint32 key[2] = {uint32(m_seed), uint32(m_seed >> 32)};
+
+      for(int r = 0; r < 10; r++) {
+        if(r) {
+          key[0] += 0x9E3779B9;
+          key[1] += 0xBB67AE85;
+        }
+        uint64 p0 = uint64(0xD2511F53) * ctr[0];
+        uint64 p1 = uint64(0xCD9E8D57) * ctr[2];
+        uint32 next[4] = {
+          uint32(p1 >> 32) ^ ctr[1] ^ key[0], uint32(p1),
+          uint32(p0 >> 32) ^ ctr[3] ^ key[1], uint32(p0)
+        };
+        for(int i = 0; i < 4; i++) {
+          ctr[i] = next[i];
+        }
+      }
+      for(int i = 0; i < 4; i++) {
+        m_block[i] = ctr[i];
+      }
+    }
+
+    uint64 m_seed;
+    uint64 m_stream;
+    uint64 m_position;
+
+    /// \brief Block of integers containing the one at m_position, if m_position % 4 != 0
+    uint32 m_block[4];
+
+  };
+
+  /// \brief Write PhiloxRand state: {"seed": int, "stream": int, "position": int}
+  jsonParser &to_json(const PhiloxRand &rand, jsonParser &json);
+
+  /// \brief Read PhiloxRand state: {"seed": int, "stream": int (default 0), "position": int (default 0)}
+  void from_json(PhiloxRand &rand, const jsonParser &json);
+
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef CASM_SobolSequence
+#define CASM_SobolSequence
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include "casm/external/Eigen/Core"
+
+namespace CASM {
+
+  /// \brief Sobol low-discrepancy sequence of points in the unit hypercube [0, 1)^dim
+  ///
+  /// - Uses the direction numbers of Joe and Kuo, "Constructing Sobol sequences with
+  ///   better two-dimensional projections", SIAM J. Sci. Comput. 30, 2635-2654 (2008),
+  ///   for up to SobolSequence::max_dim dimensions
+  /// - Points are generated in Gray code order (Antonov and Saleev), starting with
+  ///   the origin. The first 2^k points of each dimension are stratified into 2^k
+  ///   intervals of equal size, so fewer samples cover a space as evenly as a grid.
+  ///
+  class SobolSequence {
+
+  public:
+
+    typedef boost::uint32_t uint32;
+    typedef boost::uint64_t uint64;
+
+    static const int max_dim = 7;
+
+    /// \brief Number of bits of each coordinate, and log2 of the maximum number of points
+    static const int bits = 32;
+
+    explicit SobolSequence(int _dim = 1) :
+      m_dim(_dim),
+      m_direction(_dim, std::vector<uint32>(bits)) {
+
+      if(m_dim < 1 || m_dim > max_dim) {
+        throw std::runtime_error(
+          "Error in SobolSequence: dim must be in range [1, " + std::to_string(max_dim) + "]");
+      }
+
+      // s: degree of primitive polynomial, a: its coefficients, m: initial direction numbers
+      static const int s[max_dim] = {0, 1, 2, 3, 3, 4, 4};
+      static const int a[max_dim] = {0, 0, 1, 1, 2, 1, 4};
+      static const uint32 m[max_dim][4] = {
+        {0, 0, 0, 0}, {1, 0, 0, 0}, {1, 3, 0, 0}, {1, 3, 1, 0},
+        {1, 1, 1, 0}, {1, 1, 3, 3}, {1, 3, 5, 13}
+      };
+
+      for(int i = 0; i < bits; i++) {
+        m_direction[0][i] = uint32(1) << (bits - 1 - i);
+      }
+      for(int d = 1; d < m_dim; d++) {
+        std::vector<uint32> &v = m_direction[d];
+        for(int i = 0; i < s[d]; i++) {
+          v[i] = m[d][i] << (bits - 1 - i);
+        }
+        for(int i = s[d]; i < bits; i++) {
+          v[i] = v[i - s[d]] ^ (v[i - s[d]] >> s[d]);
+          for(int k = 1; k < s[d]; k++) {
+            v[i] ^= ((a[d] >> (s[d] - 1 - k)) & 1) * v[i - k];
+          }
+        }
+      }
+
+      reset();
+    }
+
+    int dim() const {
+      return m_dim;
+    }
+
+    /// \brief Number of points generated since reset
+    uint64 index() const {
+      return m_index;
+    }
+
+    /// \brief Restart the sequence at the origin
+    void reset() {
+      m_index = 0;
+      m_state.assign(m_dim, 0);
+    }
+
+    /// \brief Return the next point
+    Eigen::VectorXd next() {
+      if(m_index >> bits) {
+        throw std::runtime_error("Error in SobolSequence: maximum number of points exceeded");
+      }
+      Eigen::VectorXd point(m_dim);
+      for(int d = 0; d < m_dim; d++) {
+        point(d) = double(m_state[d]) * (1.0 / 4294967296.0);
+      }
+
+      // update state: flip the direction number of the lowest zero bit of m_index
+      int c = 0;
+      while((m_index >> c) & 1) {
+        c++;
+      }
+      if(c < bits) {
+        for(int d = 0; d < m_dim; d++) {
+          m_state[d] ^= m_direction[d][c];
+        }
+      }
+      m_index++;
+      return point;
+    }
+
+  private:
+
+    int m_dim;
+
+    uint64 m_index;
+
+    /// m_direction[d][i]: i-th direction number of dimension d
+    std::vector<std::vector<uint32> > m_direction;
+
+    std::vector<uint32> m_state;
+
+  };
+
+}
+
+#endif
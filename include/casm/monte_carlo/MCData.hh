@@ -1,11 +1,20 @@
 #ifndef MCData_HH
 #define MCData_HH
 
+#include <algorithm>
+#include <vector>
+
 #include "casm/CASM_global_definitions.hh"
 
 namespace CASM {
 
   /// \brief MCData stores observations of properties
+  ///
+  /// - Observations are stored contiguously, so that observations() is a view
+  ///   without copying
+  /// - Reserved space grows in chunks of at least the initial buffer size, by
+  ///   doubling, so that the amortized cost of push_back is O(1)
+  ///
   class MCData {
 
   public:
@@ -18,46 +27,41 @@ namespace CASM {
 
     /// \brief Constructor with initial buffer size 'count'
     MCData(size_type count) :
-      m_observation(Eigen::VectorXd::Zero(count)),
-      m_size(0) {}
+      m_chunk_size(std::max(count, size_type(1))) {
+      m_observation.reserve(m_chunk_size);
+    }
 
     /// \brief Forget all the observed values (does not resize reserved space)
     void clear() {
-      m_size = 0;
+      m_observation.clear();
     }
 
     /// \brief Add an observation
     void push_back(double value) {
-
-      m_observation(m_size) = value;
-      ++m_size;
-
-      // re-size as necessary by doubling reserved space
-      if(m_size == m_observation.size()) {
-        Eigen::VectorXd tmp = Eigen::VectorXd::Zero(m_observation.size() * 2);
-        tmp.head(m_observation.size()) = m_observation;
-        m_observation = tmp;
+      if(m_observation.size() == m_observation.capacity()) {
+        m_observation.reserve(m_observation.capacity() + std::max(m_chunk_size, size_type(m_observation.capacity())));
       }
+      m_observation.push_back(value);
     }
 
     /// \brief Return all observations
-    Eigen::VectorBlock<const Eigen::VectorXd> observations() const {
-      return m_observation.head(m_size);
+    Eigen::Map<const Eigen::VectorXd> observations() const {
+      return Eigen::Map<const Eigen::VectorXd>(m_observation.data(), m_observation.size());
     }
 
     /// \brief Number of observations
     size_type size() const {
-      return m_size;
+      return m_observation.size();
     }
 
 
   private:
 
-    /// \brief vector of all observations (includes m_size observations, and the rest is reserved space)
-    Eigen::VectorXd m_observation;
+    /// \brief Initial reserved space, and minimum amount to grow by
+    size_type m_chunk_size;
 
-    /// \brief The number of observations
-    size_type m_size;
+    /// \brief vector of all observations
+    std::vector<double> m_observation;
 
   };
 
@@ -74,7 +78,15 @@ namespace CASM {
     MCDataEquilibration() {}
 
     /// \brief Check if a range of observations have equilibrated
-    MCDataEquilibration(const Eigen::VectorXd &observations, double prec);
+    MCDataEquilibration(const Eigen::Ref<const Eigen::VectorXd> &observations, double prec);
+
+    /// \brief Update equilibration check for observations added since the last update
+    void update(const Eigen::Ref<const Eigen::VectorXd> &observations, double prec);
+
+    /// \brief Forget all observations, so that the next update starts over
+    void clear() {
+      *this = MCDataEquilibration();
+    }
 
     bool is_equilibrated() const {
       return m_is_equilibrated;
@@ -87,8 +99,37 @@ namespace CASM {
 
   private:
 
-    bool m_is_equilibrated;
-    size_type m_equil_samples;
+    /// \brief Move start2 so that the first partition has ceil((m_size - start1)/2) elements
+    void _balance(const Eigen::Ref<const Eigen::VectorXd> &observations);
+
+    bool m_is_equilibrated = false;
+    size_type m_equil_samples = 0;
+
+    // state of the partitions, for update
+
+    /// \brief Number of observations included by update
+    size_type m_size = 0;
+
+    /// \brief True if all observations included by update equal observations(0) to within 1e-8
+    bool m_all_same = true;
+
+    /// \brief Sum of all observations included by update
+    double m_sum = 0.0;
+
+    /// \brief Number of observations required before partitions are checked again
+    size_type m_next_check = 0;
+
+    /// \brief First observation of the first partition
+    size_type m_start1 = 0;
+
+    /// \brief First observation of the second partition
+    size_type m_start2 = 0;
+
+    /// \brief Sum of observations in the first partition
+    double m_sum1 = 0.0;
+
+    /// \brief Sum of observations in the second partition
+    double m_sum2 = 0.0;
 
   };
 
@@ -105,7 +146,7 @@ namespace CASM {
     MCDataConvergence() {}
 
     /// \brief Construct a MCDataConvergence object
-    MCDataConvergence(const Eigen::VectorXd &observations, double conf);
+    MCDataConvergence(const Eigen::Ref<const Eigen::VectorXd> &observations, double conf);
 
     /// \brief Returns true if converged to the requested level
     ///
@@ -113,7 +154,7 @@ namespace CASM {
     ///
     /// \returns true if Var(<X>) <= pow(prec/(sqrt(2.0)*inv_erf(1.0-conf)), 2.0)
     ///
-    /// \seealso MCDataConvergence(const Eigen::VectorXd& observations, double conf)
+    /// \seealso MCDataConvergence(const Eigen::Ref<const Eigen::VectorXd>& observations, double conf)
     ///
     bool is_converged(double prec) const {
       return m_calculated_prec <= prec;
@@ -143,7 +184,7 @@ namespace CASM {
   private:
 
     /// \brief Try to find rho = pow(2.0, -1.0/i), using min i such that CoVar[i]/CoVar[0] <= 0.5
-    std::tuple<bool, double, double> _calc_rho(const Eigen::VectorXd &observations);
+    std::tuple<bool, double, double> _calc_rho(const Eigen::Ref<const Eigen::VectorXd> &observations);
 
     bool m_is_converged;
     double m_mean;
@@ -152,6 +193,99 @@ namespace CASM {
 
   };
 
+  /// \brief Accumulates observations online to check convergence
+  ///
+  /// - Stores running sums, so that each observation is added in O(1) amortized
+  ///   time and convergence can be checked in O(log(N)) time
+  /// - Var(<X>) is estimated using the blocking method of:
+  ///   Flyvbjerg and Petersen, J. Chem. Phys. 91 (1989) 461–466.
+  ///
+  ///   Level k of the blocking ladder holds the means of consecutive blocks of
+  ///   2^k observations. Ignoring correlations, each level gives an estimate of
+  ///   Var(<X>) = Var(block means) / (number of blocks - 1), which increases with k until
+  ///   blocks are longer than the correlation time. The largest estimate from any level
+  ///   with at least 'min_blocks' blocks is used.
+  ///
+  class MCDataBlocking {
+
+  public:
+
+    typedef MCData::size_type size_type;
+
+    /// \brief Minimum number of blocks for a level of the blocking ladder to be used
+    static const size_type min_blocks = 16;
+
+    /// \brief Default constructor
+    MCDataBlocking() {}
+
+    /// \brief Forget all observations
+    void clear() {
+      m_level.clear();
+      m_size = 0;
+      m_sum = 0.0;
+      m_squared_norm = 0.0;
+    }
+
+    /// \brief Add an observation
+    void push_back(double value);
+
+    /// \brief Number of observations
+    size_type size() const {
+      return m_size;
+    }
+
+    /// \brief <X>
+    double mean() const {
+      return m_sum / m_size;
+    }
+
+    /// \brief <X*X>
+    double squared_norm() const {
+      return m_squared_norm;
+    }
+
+    /// \brief Var(<X>), estimated by blocking, or infinity if there are fewer than min_blocks observations
+    double var_of_mean() const;
+
+    /// \brief Calculated precision of <X>
+    ///
+    /// \returns sqrt(2.0*Var(<X>))*inv_erf(conf)
+    ///
+    double calculated_precision(double conf) const;
+
+    /// \brief Returns true if calculated_precision(conf) <= prec
+    bool is_converged(double prec, double conf) const {
+      return calculated_precision(conf) <= prec;
+    }
+
+  private:
+
+    /// \brief Statistics of one level of the blocking ladder
+    struct Level {
+
+      /// \brief Number of completed blocks
+      size_type count = 0;
+
+      /// \brief Sum of block means
+      double sum = 0.0;
+
+      /// \brief Sum of squared block means
+      double sum_sq = 0.0;
+
+      /// \brief True if a block mean is waiting for its pair to form a block of the next level
+      bool has_pending = false;
+
+      /// \brief Block mean waiting for its pair
+      double pending = 0.0;
+    };
+
+    std::vector<Level> m_level;
+    size_type m_size = 0;
+    double m_sum = 0.0;
+    double m_squared_norm = 0.0;
+
+  };
+
 }
 
 #endif
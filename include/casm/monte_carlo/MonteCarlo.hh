@@ -3,11 +3,12 @@
 
 #include <vector>
 #include "casm/misc/cloneable_ptr.hh"
-#include "casm/external/MersenneTwister/MersenneTwister.h"
+#include "casm/misc/PhiloxRand.hh"
 #include "casm/casm_io/Log.hh"
 #include "casm/clex/PrimClex.hh"
 #include "casm/clex/Supercell.hh"
 #include "casm/clex/ConfigDoF.hh"
+#include "casm/clex/CompactOccupation.hh"
 #include "casm/monte_carlo/MonteSettings.hh"
 #include "casm/monte_carlo/MonteSampler.hh"
 #include "casm/monte_carlo/MonteCounter.hh"
@@ -162,16 +163,36 @@ namespace CASM {
     /// \brief const Access snapshots of the Monte Carlo calculation
     ///
     /// If requested, snapshots are taken at the same time as samples. So examine sample_times for
-    /// pass and step information.
-    const std::vector<ConfigDoF> &trajectory() const {
+    /// pass and step information. Only the occupation changes during the calculation, so
+    /// snapshots store the occupation using CompactOccupation.
+    const std::vector<CompactOccupation> &trajectory() const {
       return m_trajectory;
     }
 
+    /// \brief Snapshot 'i' of the Monte Carlo calculation, as a ConfigDoF
+    ConfigDoF trajectory_configdof(Index i) const;
+
     /// \brief return true if running in debug mode
     bool debug() const {
       return m_debug;
     }
 
+    /// \brief const Access the random number generator
+    const PhiloxRand &random_generator() const {
+      return m_random;
+    }
+
+    /// \brief Set the random number generator, for example to restart a calculation exactly
+    void set_random_generator(const PhiloxRand &random) {
+      m_random = random;
+    }
+
+    /// \brief Write samples, trajectory, and random number generator state, to checkpoint a calculation
+    jsonParser &write_checkpoint(jsonParser &json) const;
+
+    /// \brief Restore samples, trajectory, and random number generator state written by write_checkpoint
+    void read_checkpoint(const jsonParser &json);
+
 
   protected:
 
@@ -209,8 +230,9 @@ namespace CASM {
       return m_log;
     }
 
-    MTRand &_mtrand() {
-      return m_twister;
+    /// \brief Access the random number generator
+    PhiloxRand &_random_generator() {
+      return m_random;
     }
 
     /// \brief Access scalar properties map
@@ -268,14 +290,17 @@ namespace CASM {
     ConfigDoF &m_configdof;
 
     /// \brief Random number generator
-    MTRand m_twister;
+    ///
+    /// - Seeded with MonteSettings::random_seed and MonteSettings::random_stream, if
+    ///   given, else with a random seed
+    PhiloxRand m_random;
 
 
     /// \brief Save trajectory?
     bool m_write_trajectory = false;
 
     /// \brief Snapshots of the Monte Carlo simulation, taken by sample_data() if m_write_trajectory is true
-    std::vector<ConfigDoF> m_trajectory;
+    std::vector<CompactOccupation> m_trajectory;
 
     /// \brief True if any Sampler must converge
     bool m_must_converge;
@@ -286,6 +311,9 @@ namespace CASM {
     /// \brief Set the next time convergence is due to be checked
     void _set_check_convergence_time() const;
 
+    /// \brief Choose a random seed, using /dev/urandom if available
+    static PhiloxRand::uint64 _random_seed();
+
     /// \brief a map of pair<keyname, index> to MonteSampler
     ///
     /// - scalar example: m_sampler[std::make_pair("formation_energy", 0)]
@@ -293,6 +321,21 @@ namespace CASM {
     ///
     SamplerMap m_sampler;
 
+    /// \brief Samplers whose values are read directly from properties by sample_data
+    ///
+    /// - Constructed by _make_sample_plan the first time sample_data is called, so that
+    ///   all properties exist
+    std::vector<std::pair<MonteSampler::SampleSource, MonteSampler *> > m_sample_plan;
+
+    /// \brief Samplers that must be sampled by calling MonteSampler::sample
+    std::vector<MonteSampler *> m_sample_custom;
+
+    /// \brief True if m_sample_plan and m_sample_custom have been constructed
+    bool m_sample_plan_ready = false;
+
+    /// \brief Construct m_sample_plan and m_sample_custom
+    void _make_sample_plan();
+
     /// \brief a vector of std::pair(pass, step) indicating when samples were taken
     SampleTimes m_sample_time;
 
@@ -321,6 +364,7 @@ namespace CASM {
     m_scel(&primclex, settings.simulation_cell_matrix()),
     m_config(m_scel),
     m_configdof(m_config.configdof()),
+    m_random(settings.is_random_seed() ? settings.random_seed() : _random_seed(), settings.random_stream()),
     m_write_trajectory(settings.write_trajectory()),
     m_log(_log),
     m_debug(m_settings.debug()) {
@@ -82,6 +82,7 @@ namespace CASM {
       if(m_halloffame) {
         m_halloffame->clear();
       }
+      m_known_occ.clear();
     }
 
     /// \brief const Access the enumeration hall of fame
@@ -120,11 +121,20 @@ namespace CASM {
     /// \brief Clear hall of fame and reset excluded
     void reset();
 
+    /// \brief Write the hall of fame configurations, to checkpoint a calculation
+    jsonParser &write_checkpoint(jsonParser &json) const;
+
+    /// \brief Re-insert hall of fame configurations written by write_checkpoint
+    void read_checkpoint(const jsonParser &json, const Configuration &mc_config);
+
   private:
 
     /// \brief Insert in hall of fame if 'check' passes
     MonteCarloEnum::HallOfFameType::InsertResult _insert(const Configuration &config);
 
+    /// \brief Insert Monte Carlo configuration in canonical form, if it is not known to be rejected
+    MonteCarloEnum::HallOfFameType::InsertResult _insert_canonical(const Configuration &config);
+
     HallOfFameType &_halloffame();
 
     /// \brief Access the PrimClex that *this is based on
@@ -175,6 +185,12 @@ namespace CASM {
     /// \brief holds 'is_new, score' data
     std::map<std::string, std::pair<bool, double> > m_data;
 
+    /// \brief Occupation and score of Monte Carlo configurations whose canonical form
+    ///        has already been inserted in the hall of fame, or was excluded
+    ///
+    /// - Used by _insert_canonical to skip canonicalizing repeated configurations
+    std::map<std::vector<int>, double> m_known_occ;
+
 
   };
 }
@@ -41,6 +41,9 @@ namespace CASM {
     /// \brief Number of samples taken
     size_type samples() const;
 
+    /// \brief Number of passes or steps since the last sample was taken
+    size_type since_last_sample() const;
+
 
     /// \brief Increments the number of samples taken and resets counter until the next sample should be taken
     void increment_samples();
@@ -52,7 +55,8 @@ namespace CASM {
     /// \brief Set all counter variables for performing a restart
     void set(size_type _pass,
              size_type _step,
-             size_type _samples);
+             size_type _samples,
+             size_type _since_last_sample = 0);
 
 
     /// \brief Returns true if based on period and current number of steps it is time to take a sample
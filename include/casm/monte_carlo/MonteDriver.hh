@@ -3,6 +3,7 @@
 
 #include <string>
 #include "casm/external/boost.hh"
+#include "casm/casm_io/SafeOfstream.hh"
 
 #include "casm/monte_carlo/MonteIO.hh"
 #include "casm/monte_carlo/MonteCarlo.hh"
@@ -35,6 +36,11 @@ namespace CASM {
     /// \brief Run everything requested by the MonteSettings
     void run();
 
+    /// \brief const Access the Monte Carlo calculation
+    const RunType &mc() const {
+      return m_mc;
+    }
+
   private:
 
     /// run in debug mode?
@@ -45,8 +51,14 @@ namespace CASM {
     ///Return the appropriate std::vector of conditions to visit based from settings. Use for construction.
     std::vector<CondType> make_conditions_list(const PrimClex &primclex, const SettingsType &settings);
 
-    ///Converge the MonteCarlo for conditions 'cond_index'
-    void single_run(Index cond_index);
+    ///Converge the MonteCarlo for conditions 'cond_index', optionally continuing from a checkpoint
+    void single_run(Index cond_index, bool from_checkpoint = false);
+
+    ///Write the state of an unfinished calculation for conditions 'cond_index'
+    void _write_checkpoint(Index cond_index, const MonteCounter &counter) const;
+
+    ///Read the state of an unfinished calculation for conditions 'cond_index'
+    void _read_checkpoint(Index cond_index, MonteCounter &counter);
 
     ///Check for existing calculations to find starting conditions
     Index _find_starting_conditions() const;
@@ -106,6 +118,8 @@ namespace CASM {
   ///   and that no other results are written to the results summary.
   /// - If there are existing results, uses "output_dir/conditions.i/final_state.json" as
   ///   the initial state for the next run
+  /// - If "output_dir/conditions.i/checkpoint.json" exists for the first unfinished
+  ///   calculation, it is continued from the checkpoint
   template<typename RunType>
   void MonteDriver<RunType>::run() {
 
@@ -134,6 +148,8 @@ namespace CASM {
       return;
     }
 
+    bool from_checkpoint = fs::exists(m_dir.checkpoint_json(start_i));
+
     // if existing calculations
     if(start_i > 0 || repeats.size() > 0) {
 
@@ -145,6 +161,9 @@ namespace CASM {
         to_json(repeats, json);
         m_log << "will overwrite existing results for condition(s): " << json << "\n";
       }
+      if(from_checkpoint) {
+        m_log << "will continue condition " << start_i << " from: " << m_dir.checkpoint_json(start_i) << "\n";
+      }
     }
     else {
       m_log << "did not find existing calculations\n";
@@ -160,7 +179,7 @@ namespace CASM {
         m_mc.set_state(m_conditions_list[0], m_settings);
 
         // perform any requested explicit equilibration passes
-        if(m_settings.dependent_runs() && m_settings.is_equilibration_passes_first_run()) {
+        if(m_settings.dependent_runs() && m_settings.is_equilibration_passes_first_run() && !from_checkpoint) {
 
           auto equil_passes = m_settings.equilibration_passes_first_run();
 
@@ -207,7 +226,16 @@ namespace CASM {
         m_log << std::endl;
       }
 
-      single_run(i);
+      // if restarting a condition, use the same random numbers
+      if(i == start_i && !from_checkpoint && fs::exists(m_dir.random_json(i))) {
+        PhiloxRand random;
+        from_json(random, jsonParser(m_dir.random_json(i)));
+        m_mc.set_random_generator(random);
+        m_log.read("Random number generator state");
+        m_log << "read: " << m_dir.random_json(i) << "\n" << std::endl;
+      }
+
+      single_run(i, i == start_i && from_checkpoint);
 
       m_log << std::endl;
     }
@@ -299,36 +327,65 @@ namespace CASM {
     return start_i;
   }
 
+  /// \brief Converge the MonteCarlo for conditions 'cond_index', optionally continuing from a checkpoint
+  ///
+  /// - If 'from_checkpoint', the state written by '_write_checkpoint' to
+  ///   "output_dir/conditions.i/checkpoint.json" replaces the current state, and the
+  ///   calculation continues from there without repeating equilibration passes
+  /// - Else, any existing checkpoint for these conditions is removed
+  /// - Checkpoints are written at the end of a pass, if either the number of passes
+  ///   or the wall time since the last checkpoint exceeds the requested period
+  /// - The checkpoint is removed when the calculation is complete
+  ///
   template<typename RunType>
-  void MonteDriver<RunType>::single_run(Index cond_index) {
+  void MonteDriver<RunType>::single_run(Index cond_index, bool from_checkpoint) {
 
     fs::create_directories(m_dir.conditions_dir(cond_index));
 
-    // perform any requested explicit equilibration passes
-    if(m_settings.is_equilibration_passes_each_run()) {
+    MonteCounter run_counter(m_settings, m_mc.steps_per_pass());
+    if(m_enum) {
+      m_enum->reset();
+    };
 
-      m_log.write("DoF");
-      m_log << "write: " << m_dir.initial_state_runeq_json(cond_index) << "\n" << std::endl;
+    jsonParser json;
+    if(from_checkpoint) {
+      _read_checkpoint(cond_index, run_counter);
+    }
+    else {
+      if(fs::exists(m_dir.checkpoint_json(cond_index))) {
+        fs::remove(m_dir.checkpoint_json(cond_index));
+      }
+
+      // random number generator state, to allow repeating this run exactly
+      m_log.write("Random number generator state");
+      m_log << "write: " << m_dir.random_json(cond_index) << "\n" << std::endl;
+      jsonParser random_json;
+      to_json(m_mc.random_generator(), random_json).write(m_dir.random_json(cond_index));
+
+      // perform any requested explicit equilibration passes
+      if(m_settings.is_equilibration_passes_each_run()) {
+
+        m_log.write("DoF");
+        m_log << "write: " << m_dir.initial_state_runeq_json(cond_index) << "\n" << std::endl;
 
-      jsonParser json;
-      to_json(m_mc.configdof(), json).write(m_dir.initial_state_runeq_json(cond_index));
-      auto equil_passes = m_settings.equilibration_passes_each_run();
+        to_json(m_mc.configdof(), json).write(m_dir.initial_state_runeq_json(cond_index));
+        auto equil_passes = m_settings.equilibration_passes_each_run();
 
-      m_log.begin("Equilibration passes");
-      m_log << equil_passes << " equilibration passes\n" << std::endl;
+        m_log.begin("Equilibration passes");
+        m_log << equil_passes << " equilibration passes\n" << std::endl;
 
-      MonteCounter equil_counter(m_settings, m_mc.steps_per_pass());
-      while(equil_counter.pass() != equil_passes) {
-        monte_carlo_step(m_mc);
-        equil_counter++;
+        MonteCounter equil_counter(m_settings, m_mc.steps_per_pass());
+        while(equil_counter.pass() != equil_passes) {
+          monte_carlo_step(m_mc);
+          equil_counter++;
+        }
       }
-    }
 
-    // initial state (after any equilibriation passes)
-    m_log.write("DoF");
-    m_log << "write: " << m_dir.initial_state_json(cond_index) << "\n" << std::endl;
-    jsonParser json;
-    to_json(m_mc.configdof(), json).write(m_dir.initial_state_json(cond_index));
+      // initial state (after any equilibriation passes)
+      m_log.write("DoF");
+      m_log << "write: " << m_dir.initial_state_json(cond_index) << "\n" << std::endl;
+      to_json(m_mc.configdof(), json).write(m_dir.initial_state_json(cond_index));
+    }
 
     std::stringstream ss;
     ss << "Conditions " << cond_index;
@@ -336,10 +393,11 @@ namespace CASM {
     m_log << std::endl;
     m_log.begin_lap();
 
-    MonteCounter run_counter(m_settings, m_mc.steps_per_pass());
-    if(m_enum) {
-      m_enum->reset();
-    };
+    // checkpoint periods, 0 if not requested
+    MonteCounter::size_type checkpoint_passes = m_settings.checkpoint_period_passes();
+    double checkpoint_time = m_settings.checkpoint_period_time();
+    MonteCounter::size_type last_checkpoint_pass = run_counter.pass();
+    double last_checkpoint_time = 0.0;
 
     while(true) {
 
@@ -408,6 +466,16 @@ namespace CASM {
           m_enum->insert(m_mc.config());
         }
       }
+
+      // checkpoint at the end of a pass, if due
+      if(run_counter.step() == 0 && (checkpoint_passes || checkpoint_time > 0.0)) {
+        if((checkpoint_passes && run_counter.pass() - last_checkpoint_pass >= checkpoint_passes) ||
+           (checkpoint_time > 0.0 && m_log.lap_time() - last_checkpoint_time >= checkpoint_time)) {
+          _write_checkpoint(cond_index, run_counter);
+          last_checkpoint_pass = run_counter.pass();
+          last_checkpoint_time = m_log.lap_time();
+        }
+      }
     }
     m_log << std::endl;
 
@@ -429,9 +497,100 @@ namespace CASM {
       m_enum->save_configs();
     }
 
+    if(fs::exists(m_dir.checkpoint_json(cond_index))) {
+      fs::remove(m_dir.checkpoint_json(cond_index));
+    }
+
     return;
   }
 
+  /// \brief Write the state of an unfinished calculation for conditions 'cond_index'
+  ///
+  /// Writes "output_dir/conditions.i/checkpoint.json":
+  /// \code
+  /// {
+  ///   "configdof": current ConfigDoF,
+  ///   "counter": {"pass": int, "step": int, "samples": int, "since_last_sample": int},
+  ///   ... RunType::write_checkpoint: samples, random number generator state, etc.,
+  ///   "enum": MonteCarloEnum::write_checkpoint (if enumerating configurations)
+  /// }
+  /// \endcode
+  ///
+  /// - Written using SafeOfstream, so that an existing checkpoint is only replaced
+  ///   once the new checkpoint is completely written
+  template<typename RunType>
+  void MonteDriver<RunType>::_write_checkpoint(Index cond_index, const MonteCounter &counter) const {
+
+    jsonParser json;
+    m_mc.write_checkpoint(json);
+    to_json(m_mc.configdof(), json["configdof"]);
+
+    jsonParser &counter_json = json["counter"];
+    counter_json["pass"] = counter.pass();
+    counter_json["step"] = counter.step();
+    counter_json["samples"] = counter.samples();
+    counter_json["since_last_sample"] = counter.since_last_sample();
+
+    if(m_enum) {
+      m_enum->write_checkpoint(json["enum"]);
+    }
+
+    // remove any partial checkpoint left by an interrupted write
+    fs::path tmp_path = m_dir.checkpoint_json(cond_index).string() + ".tmp";
+    if(fs::exists(tmp_path)) {
+      fs::remove(tmp_path);
+    }
+
+    // print with full precision, so that observations are restored exactly
+    SafeOfstream file;
+    file.open(m_dir.checkpoint_json(cond_index));
+    json.print(file.ofstream(), 2, 17);
+    file.close();
+
+    if(debug()) {
+      m_log.custom<Log::debug>("Checkpoint");
+      m_log << "pass: " << counter.pass() << "  "
+            << "samples: " << counter.samples() << "\n"
+            << "write: " << m_dir.checkpoint_json(cond_index) << "\n" << std::endl;
+    }
+  }
+
+  /// \brief Read the state of an unfinished calculation for conditions 'cond_index'
+  ///
+  /// - Sets the MonteCarlo state for conditions 'cond_index' and restores the samples,
+  ///   random number generator state, etc., the MonteCounter, and the MonteCarloEnum
+  ///   hall of fame written by '_write_checkpoint'
+  template<typename RunType>
+  void MonteDriver<RunType>::_read_checkpoint(Index cond_index, MonteCounter &counter) {
+
+    jsonParser json(m_dir.checkpoint_json(cond_index));
+
+    ConfigDoF configdof = m_mc.configdof();
+    from_json(configdof, json["configdof"]);
+    m_mc.set_state(
+      m_conditions_list[cond_index],
+      configdof,
+      std::string("Using: ") + m_dir.checkpoint_json(cond_index).string());
+    m_mc.read_checkpoint(json);
+
+    const jsonParser &counter_json = json["counter"];
+    counter.set(
+      counter_json["pass"].get<MonteCounter::size_type>(),
+      counter_json["step"].get<MonteCounter::size_type>(),
+      counter_json["samples"].get<MonteCounter::size_type>(),
+      counter_json["since_last_sample"].get<MonteCounter::size_type>());
+
+    if(m_enum && json.contains("enum")) {
+      m_enum->read_checkpoint(json["enum"], m_mc.config());
+    }
+
+    m_log.read("Checkpoint");
+    m_log << "read: " << m_dir.checkpoint_json(cond_index) << "\n"
+          << "pass: " << counter.pass() << "  "
+          << "step: " << counter.step() << "  "
+          << "samples: " << counter.samples() << "\n" << std::endl;
+  }
+
   /**
    * Reads from the settings and constructs an appropriate
    * std::vector of conditions for MonteDriver to visit.
@@ -41,6 +41,20 @@ namespace CASM {
       return conditions_dir(cond_index) / "conditions.json";
     }
 
+    /// \brief "output_dir/conditions.cond_index/random.json"
+    ///
+    /// - Random number generator state before first pass / step
+    fs::path random_json(int cond_index) const {
+      return conditions_dir(cond_index) / "random.json";
+    }
+
+    /// \brief "output_dir/conditions.cond_index/checkpoint.json"
+    ///
+    /// - State of an unfinished calculation, to allow continuing it
+    fs::path checkpoint_json(int cond_index) const {
+      return conditions_dir(cond_index) / "checkpoint.json";
+    }
+
     /// \brief "output_dir/conditions.cond_index/observations.csv"
     fs::path observations_csv(int cond_index) const {
       return conditions_dir(cond_index) / "observations.csv";
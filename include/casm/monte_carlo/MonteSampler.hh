@@ -18,6 +18,9 @@ namespace CASM {
   ///   of 'virtual void sample(const MonteCarlo &mc, const MonteCounter &counter) = 0;'
   /// - Optionally may require and check for convergence to some level of precision
   ///   given a particular confidence level
+  /// - Derived classes that sample an element of a MonteCarlo scalar or vector property
+  ///   may also implement 'sample_source', which lets MonteCarlo::sample_data read
+  ///   the property directly, without calling 'sample' for each observation
   ///
   class MonteSampler {
 
@@ -25,6 +28,21 @@ namespace CASM {
 
     typedef MCData::size_type size_type;
 
+    /// \brief Location of the value sampled from a MonteCarlo object
+    ///
+    /// - The sampled value is '(*scalar) / norm' if 'scalar' is not null, else
+    ///   '(*vector)(index) / norm' if 'vector' is not null
+    /// - If both are null, the sampler must be sampled by calling 'sample'
+    /// - Pointers are to MonteCarlo property map values, which remain valid as the
+    ///   properties are updated
+    ///
+    struct SampleSource {
+      const double *scalar = nullptr;
+      const Eigen::VectorXd *vector = nullptr;
+      Index index = 0;
+      double norm = 1.0;
+    };
+
     /// \brief Construct sampler that does not need to converge
     MonteSampler(const std::string &print_name,
                  double data_confidence,
@@ -43,14 +61,25 @@ namespace CASM {
       throw std::runtime_error("Error: MonteSampler base class used to sample");
     }
 
+    /// \brief Location of the sampled value, if it can be read directly from 'mc'
+    virtual SampleSource sample_source(const MonteCarlo &mc) const {
+      return SampleSource();
+    }
+
     /// \brief Clear all data observations
     void clear() {
       m_data.clear();
+      m_equilibration.clear();
+      m_equilibration_uptodate = false;
+      m_convergence.clear();
+      m_convergence_uptodate = false;
     }
 
     /// \brief Returns pair(true, equil_steps) if equilibration has occured to required precision
     ///
     /// - If must_converge() == false, always returns false
+    /// - Only the observations added since the last check are processed, see
+    ///   MCDataEquilibration::update
     ///
     std::pair<bool, size_type> is_equilibrated() const {
 
@@ -58,8 +87,8 @@ namespace CASM {
         return std::make_pair(false, m_data.size());
       }
 
-      if(!m_convergence_uptodate) {
-        m_equilibration = MCDataEquilibration(m_data.observations(), m_prec);
+      if(!m_equilibration_uptodate) {
+        m_equilibration.update(m_data.observations(), m_prec);
         m_equilibration_uptodate = true;
       }
 
@@ -79,6 +108,8 @@ namespace CASM {
     /// \brief Returns true if convergence criteria have been met for data sampled in range [equil_samples, end)
     ///
     /// - If must_converge() == false, always returns false
+    /// - Statistics are accumulated online, see MCDataBlocking, so this is cheap to call
+    ///   after every sample as long as 'equil_samples' does not change
     bool is_converged(size_type equil_samples) const {
 
       if(!must_converge()) {
@@ -90,7 +121,7 @@ namespace CASM {
         _check_convergence(equil_samples);
       }
 
-      return m_convergence.is_converged(m_prec);
+      return m_convergence.is_converged(m_prec, m_conf);
     }
 
     /// \brief Returns <X> for data sampled in range [equil_samples, end)
@@ -123,7 +154,7 @@ namespace CASM {
         _check_convergence(equil_samples);
       }
 
-      return m_convergence.calculated_precision();
+      return m_convergence.calculated_precision(m_conf);
     }
 
     /// \brief const Access the raw data observation container
@@ -144,6 +175,8 @@ namespace CASM {
 
   protected:
 
+    friend class MonteCarlo;
+
     /// \brief Access the raw data observation container
     MCData &data() {
       m_convergence_uptodate = false;
@@ -157,10 +190,19 @@ namespace CASM {
       return new MonteSampler(*this);
     }
 
+    /// \brief Add observations in range [equil_samples, end) to m_convergence
+    ///
+    /// - Restarts accumulation if equil_samples has changed
     void _check_convergence(size_type equil_samples) const {
 
-      m_convergence_start_sample = equil_samples;
-      m_convergence = MCDataConvergence(m_data.observations().segment(equil_samples, m_data.observations().size() - equil_samples), m_conf);
+      if(m_convergence_start_sample != equil_samples || equil_samples + m_convergence.size() > m_data.size()) {
+        m_convergence.clear();
+        m_convergence_start_sample = equil_samples;
+      }
+      auto obs = m_data.observations();
+      for(size_type i = equil_samples + m_convergence.size(); i < m_data.size(); ++i) {
+        m_convergence.push_back(obs(i));
+      }
       m_convergence_uptodate = true;
     }
 
@@ -185,7 +227,7 @@ namespace CASM {
     mutable MCDataEquilibration m_equilibration;
     mutable bool m_convergence_uptodate = false;
     mutable size_type m_convergence_start_sample = 0;
-    mutable MCDataConvergence m_convergence;
+    mutable MCDataBlocking m_convergence;
   };
 
 
@@ -212,6 +254,9 @@ namespace CASM {
     /// \brief Sample data from a MonteCarlo calculation
     void sample(const MonteCarlo &mc, const MonteCounter &counter);
 
+    /// \brief Location of the sampled value
+    SampleSource sample_source(const MonteCarlo &mc) const;
+
     /// \brief Clone this object
     std::unique_ptr<ScalarMonteSampler> clone() const {
       return std::unique_ptr<ScalarMonteSampler>(this->_clone());
@@ -254,6 +299,9 @@ namespace CASM {
     /// \brief Sample data from a MonteCarlo calculation
     void sample(const MonteCarlo &mc, const MonteCounter &counter);
 
+    /// \brief Location of the sampled value
+    SampleSource sample_source(const MonteCarlo &mc) const;
+
     /// \brief Clone this object
     std::unique_ptr<VectorMonteSampler> clone() const {
       return std::unique_ptr<VectorMonteSampler>(this->_clone());
@@ -418,6 +466,9 @@ namespace CASM {
     /// \brief Sample data from a MonteCarlo calculation
     void sample(const MonteCarlo &mc, const MonteCounter &counter);
 
+    /// \brief Location of the sampled value
+    SampleSource sample_source(const MonteCarlo &mc) const;
+
     /// \brief Clone this object
     std::unique_ptr<SiteFracMonteSampler> clone() const {
       return std::unique_ptr<SiteFracMonteSampler>(this->_clone());
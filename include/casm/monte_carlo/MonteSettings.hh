@@ -114,6 +114,24 @@ namespace CASM {
     ///        of the previous calculation. Default true.
     bool dependent_runs() const;
 
+    /// \brief Returns true if a random number generator seed has been specified
+    bool is_random_seed() const;
+
+    /// \brief Random number generator seed
+    unsigned long random_seed() const;
+
+    /// \brief Random number generator stream. Default 0.
+    unsigned long random_stream() const;
+
+    /// \brief Returns true if periodic checkpoints of unfinished calculations are requested
+    bool is_checkpoint() const;
+
+    /// \brief Number of passes between checkpoints. Default 0 (none).
+    size_type checkpoint_period_passes() const;
+
+    /// \brief Wall time (s) between checkpoints. Default 0.0 (none).
+    double checkpoint_period_time() const;
+
 
     // --- Sampling -------------------
 
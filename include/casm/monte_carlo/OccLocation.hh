@@ -11,6 +11,7 @@ namespace CASM {
 
   class Configuration;
   class ConfigDoF;
+  class PhiloxRand;
 
   namespace Monte {
 
@@ -98,11 +99,23 @@ namespace CASM {
       /// Convert from config index to variable site index
       Index l_to_mol_id(Index l) const;
 
+      /// Mol.id of all mutating sites, by OccCandidate type: loc()[cand_index][loc] -> Mol.id
+      const std::vector<std::vector<Index> > &loc() const;
+
+      /// Reorder Mol of each OccCandidate type, for example to restart a calculation exactly
+      void set_loc(const std::vector<std::vector<Index> > &_loc);
+
       /// Propose canonical OccEvent
-      OccEvent &propose_canonical(OccEvent &e, const std::vector<OccSwap> &canonical_swap, MTRand &mtrand) const;
+      ///
+      /// - RandomGenerator may be MTRand or PhiloxRand
+      template<typename RandomGenerator>
+      OccEvent &propose_canonical(OccEvent &e, const std::vector<OccSwap> &canonical_swap, RandomGenerator &random) const;
 
       /// Propose grand canonical OccEvent
-      OccEvent &propose_grand_canonical(OccEvent &e, const OccSwap &swap, MTRand &mtrand) const;
+      ///
+      /// - RandomGenerator may be MTRand or PhiloxRand
+      template<typename RandomGenerator>
+      OccEvent &propose_grand_canonical(OccEvent &e, const OccSwap &swap, RandomGenerator &random) const;
 
       /// Update configdof and this to reflect that event 'e' occurred
       void apply(const OccEvent &e, ConfigDoF &configdof);
@@ -110,10 +123,12 @@ namespace CASM {
     private:
 
       /// Canonical propose
-      OccEvent &_propose(OccEvent &e, const OccSwap &swap, MTRand &mtrand, Index cand_a, Index cand_b, Index size_a, Index size_b) const;
+      template<typename RandomGenerator>
+      OccEvent &_propose(OccEvent &e, const OccSwap &swap, RandomGenerator &random, Index cand_a, Index cand_b, Index size_a, Index size_b) const;
 
       /// Canonical propose
-      OccEvent &_propose(OccEvent &e, const OccSwap &swap, MTRand &mtrand) const;
+      template<typename RandomGenerator>
+      OccEvent &_propose(OccEvent &e, const OccSwap &swap, RandomGenerator &random) const;
 
       const Conversions &m_convert;
 
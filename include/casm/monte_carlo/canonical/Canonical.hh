@@ -89,6 +89,12 @@ namespace CASM {
       /// \brief Write results to files
       void write_results(Index cond_index) const;
 
+      /// \brief Write samples, random number generator state, and site lists, to checkpoint a calculation
+      jsonParser &write_checkpoint(jsonParser &json) const;
+
+      /// \brief Restore samples, random number generator state, and site lists written by write_checkpoint
+      void read_checkpoint(const jsonParser &json);
+
 
       /// \brief Formation energy, normalized per primitive cell
       const double &formation_energy() const {
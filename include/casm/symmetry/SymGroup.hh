@@ -186,6 +186,19 @@ namespace CASM {
 
     void from_json(const jsonParser &json);
 
+    /// \brief Hash of the operations, periodicity, and lattice, identifying the group tables
+    std::string tables_hash() const;
+
+    /// \brief Write multiplication tables, conjugacy classes, character table, and subgroups,
+    /// generating them if necessary
+    jsonParser &tables_to_json(jsonParser &json) const;
+
+    /// \brief Read tables written by tables_to_json
+    ///
+    /// \returns false, leaving the tables unchanged, if the tables were not written for
+    ///          a group with the same tables_hash()
+    bool tables_from_json(const jsonParser &json) const;
+
     SymInfo info(Index i) const;
 
   protected:
@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <cmath>
+#include <memory>
 
 #include "casm/external/Eigen/Dense"
 
@@ -22,6 +23,10 @@ namespace CASM {
   class SymMatrixXd : public SymOpRepresentation {
   private:
     Eigen::MatrixXd mat;
+
+    /// Sparse form of 'mat', calculated when first requested and shared by copies
+    mutable std::shared_ptr<const Eigen::SparseMatrix<double> > m_sparse_mat;
+
   public:
     SymMatrixXd(const Eigen::MatrixXd &init_mat) : mat(init_mat) {};
 
@@ -33,6 +38,8 @@ namespace CASM {
       return &mat;
     }
 
+    Eigen::SparseMatrix<double> const *get_SparseMatrix() const override;
+
     double character() const override {
       return mat.trace();
     }
@@ -5,6 +5,7 @@
 #include <cmath>
 
 #include "casm/CASM_global_definitions.hh"
+#include "casm/external/Eigen/SparseCore"
 #include "casm/container/Array.hh"
 #include "casm/symmetry/SymGroupRepID.hh"
 
@@ -47,6 +48,14 @@ namespace CASM {
       return nullptr;
     }
 
+    /// \brief Matrix representation, in column-major sparse form with almost zero elements removed
+    ///
+    /// - Use to transform by only the non-zero elements of a representation matrix,
+    ///   iterating over column 'j' with Eigen::SparseMatrix<double>::InnerIterator(*mat, j)
+    virtual Eigen::SparseMatrix<double> const *get_SparseMatrix() const {
+      return nullptr;
+    }
+
     virtual SymBasisPermute const *get_ucc_permutation() const {
       return nullptr;
     }
@@ -55,6 +64,9 @@ namespace CASM {
     /// get pointer to matrix representation corresponding to rep_ID
     Eigen::MatrixXd const *get_matrix_rep(SymGroupRepID _rep_ID) const;
 
+    /// get pointer to sparse matrix representation corresponding to rep_ID
+    Eigen::SparseMatrix<double> const *get_sparse_matrix_rep(SymGroupRepID _rep_ID) const;
+
     /// get pointer to permutation representation corresponding to _rep_ID
     Permutation const *get_permutation_rep(SymGroupRepID _rep_ID) const;
 
@@ -64,6 +76,9 @@ namespace CASM {
     /// get array of pointers to matrix representations for representations corresponding to _rep_IDs
     Array<Eigen::MatrixXd const * > get_matrix_reps(Array<SymGroupRepID> _rep_IDs) const;
 
+    /// get array of pointers to sparse matrix representations for representations corresponding to _rep_IDs
+    Array<Eigen::SparseMatrix<double> const * > get_sparse_matrix_reps(Array<SymGroupRepID> _rep_IDs) const;
+
     /// set representation for SymOp corresponding to _rep_ID
     void set_rep(SymGroupRepID _rep_ID, const SymOpRepresentation &op_rep) const;
 
@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <cmath>
+#include <memory>
 #include "casm/symmetry/SymOpRepresentation.hh"
 #include "casm/container/Permutation.hh"
 
@@ -49,6 +50,9 @@ namespace CASM {
       return &m_mat;
     }
 
+    /// Access the permutation matrix in sparse form, without constructing the dense matrix
+    Eigen::SparseMatrix<double> const *get_SparseMatrix() const override;
+
     jsonParser &to_json(jsonParser &json) const override;
 
     void from_json(const jsonParser &json) override;
@@ -66,6 +70,9 @@ namespace CASM {
     /// Matrix is nxn, where 'n' is the number of things that are permuted
     mutable Eigen::MatrixXd m_mat;
 
+    /// Sparse permutation matrix, calculated when first requested and shared by copies
+    mutable std::shared_ptr<const Eigen::SparseMatrix<double> > m_sparse_mat;
+
     /// Generate the matrix of permutation, when m_permute is known
     void _calc_mat() const;
 
@@ -50,6 +50,15 @@ extern "C" {
   int casm_capi(char *args, cPrimClex *primclex, char *root, costream *log, costream *debug_log, costream *err_log);
 
   int casm_capi_call(char *args, cPrimClex *primclex);
+
+
+  int casm_query_size(cPrimClex *primclex, char *selection, char *args, unsigned long *n_config, unsigned long *n_values);
+
+  int casm_query_double(cPrimClex *primclex, char *selection, char *args, double *buffer, unsigned long buffer_size);
+
+  int casm_occupation_size(cPrimClex *primclex, char *selection, unsigned long *n_config, unsigned long *n_sites);
+
+  int casm_occupation(cPrimClex *primclex, char *selection, int *occ, unsigned long occ_size, unsigned long *offsets, unsigned long offsets_size);
 }
 
 /** @} */
@@ -38,6 +38,13 @@ from sys import platform
 #   each group and used to setup the testing environment for 'make check'
 # - See 'tests/README.md' for more about testing
 #
+# Benchmarks:
+# - Benchmarks are in benchmarks/*_bench.cpp, and are built into the
+#   'casm_benchmarks' program, which is only built and run by 'make benchmarks'
+# - A @abs_top_srcdir@/benchmarks/run_benchmarks.in file is generated and used
+#   to setup the benchmarking environment
+# - See 'benchmarks/README.md' for more about benchmarks
+#
 # Makefile.am and configure.ac:
 # - Makemodule.am and unit test files generated by this script are automatically
 #   included in the autotools files between the lines:
@@ -219,6 +226,16 @@ def run_test_in(group):
         f.write(': ${TEST_FLAGS:="--log_level=test_suite --catch_system_errors=no"}\n')
         f.write('@abs_top_builddir@/casm_unit_$GROUP ${TEST_FLAGS}\n')
 
+def run_benchmarks_in():
+    """Write 'run_benchmarks.in' file"""
+    with open(join('benchmarks', 'run_benchmarks.in'), 'w') as f:
+        f.write('#!/bin/bash\n')
+        f.write('export PATH=@abs_top_builddir@:$PATH\n')
+        f.write('cd @abs_top_srcdir@\n')
+        f.write('mkdir -p @abs_top_srcdir@/tests/unit/test_projects\n')
+        f.write(': ${BENCHMARK_FLAGS:="--log_level=test_suite --catch_system_errors=no"}\n')
+        f.write('@abs_top_builddir@/casm_benchmarks ${BENCHMARK_FLAGS}\n')
+
 def replace_lines(filename, lines_to_insert):
     """Replace lines in a file
 
@@ -325,6 +342,25 @@ def main():
             write_option(f, 'casm_complete', 'LDFLAGS', rpath_ldflags)
         f.write('endif\n')
 
+    # benchmarks/Makemodule.am
+    dir = 'benchmarks'
+    print('Working on', dir)
+    makemodules.append(join('benchmarks', 'Makemodule.am'))
+    with open(makemodules[-1], 'w') as f:
+        # only built by 'make benchmarks'
+        append(f, 'EXTRA_PROGRAMS', ['casm_benchmarks'])
+        write_option(f, 'casm_benchmarks', 'CXXFLAGS', ['$(AM_CXXFLAGS)', '-I$(top_srcdir)/tests/unit/', '-I$(top_srcdir)/benchmarks/'])
+        if rpath_ldflags is not None:
+            write_option(f, 'casm_benchmarks', 'LDFLAGS', rpath_ldflags)
+        files = sorted(glob(join(dir, '*.cpp')) + glob(join(dir, '*.cc')))
+        write_option(f, 'casm_benchmarks', 'SOURCES', files)
+        write_option(f, 'casm_benchmarks', 'LDADD', lib_casm + lib_casm_testing + boost_libs + boost_test_libs)
+        append(f, 'EXTRA_DIST', sorted(glob(join(dir, '*.hh')) + [join(dir, 'README.md')]))
+        f.write('benchmarks: casm_benchmarks$(EXEEXT) ccasm$(EXEEXT)\n')
+        f.write('\t./benchmarks/run_benchmarks\n\n')
+        f.write('.PHONY: benchmarks\n')
+        run_benchmarks_in()
+
     # tests/unit/Makemodule.am
     dir = join('tests', 'unit')
     print('Working on', dir)
@@ -366,11 +402,13 @@ def main():
     # Update 'Makefile.am' to include all Makemodule.am
     replace_lines('Makefile.am', ['include $(srcdir)/'+val+'\n' for val in makemodules])
 
-    # Update 'configure.ac' to include all 'run_test_<name>'
+    # Update 'configure.ac' to include all 'run_test_<name>' and 'run_benchmarks'
     lines_to_insert = []
     for name in testnames:
         runtest = join('tests', 'unit', name, 'run_test_' + name)
         lines_to_insert.append('AC_CONFIG_FILES([' + runtest + '], [chmod +x ' + runtest + '])\n')
+    runbench = join('benchmarks', 'run_benchmarks')
+    lines_to_insert.append('AC_CONFIG_FILES([' + runbench + '], [chmod +x ' + runbench + '])\n')
     replace_lines('configure.ac', lines_to_insert)
 
 
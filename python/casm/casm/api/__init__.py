@@ -1,8 +1,9 @@
 """Access libcasm via Python"""
-from casm.api.api import API, command_list, casm_command, casm_capture
+from casm.api.api import API, command_list, casm_command, casm_capture, server_command
 __all__ = [
   'API',
   'command_list',
   'casm_command',
-  'casm_capture'
+  'casm_capture',
+  'server_command'
  ]
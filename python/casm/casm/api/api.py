@@ -4,6 +4,7 @@ from builtins import *
 import ctypes
 import glob
 import json
+import numpy as np
 import os
 import six
 from distutils.spawn import find_executable
@@ -137,6 +138,18 @@ class API(object):
       self.lib_ccasm.casm_capi_call.argtypes = [ctypes.c_char_p, ctypes.c_void_p]
       self.lib_ccasm.casm_capi_call.restype = ctypes.c_int
 
+      self.lib_ccasm.casm_query_size.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_char_p, ctypes.POINTER(ctypes.c_ulong), ctypes.POINTER(ctypes.c_ulong)]
+      self.lib_ccasm.casm_query_size.restype = ctypes.c_int
+
+      self.lib_ccasm.casm_query_double.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_char_p, ctypes.POINTER(ctypes.c_double), ctypes.c_ulong]
+      self.lib_ccasm.casm_query_double.restype = ctypes.c_int
+
+      self.lib_ccasm.casm_occupation_size.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.POINTER(ctypes.c_ulong), ctypes.POINTER(ctypes.c_ulong)]
+      self.lib_ccasm.casm_occupation_size.restype = ctypes.c_int
+
+      self.lib_ccasm.casm_occupation.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.POINTER(ctypes.c_int), ctypes.c_ulong, ctypes.POINTER(ctypes.c_ulong), ctypes.c_ulong]
+      self.lib_ccasm.casm_occupation.restype = ctypes.c_int
+
   __api = None
 
   def __init__(self):
@@ -453,6 +466,80 @@ class API(object):
     """
     return API.__api.lib_ccasm.casm_capi_call(six.b(args), primclex)
 
+  def query_array(self, primclex, selection, args):
+    """
+    Evaluate numeric query properties for selected configurations, without
+    writing and parsing text output
+
+    Arguments
+    ---------
+
+      primclex: CASM::PrimClex pointer
+        A pointer to a CASM::PrimClex, as obtained from API.primclex_new()
+
+      selection: str
+        "MASTER", "ALL", "CALCULATED", "EMPTY", or a path to a selection file
+
+      args: str
+        Query properties, as for 'casm query -k'
+
+          Ex: "corr comp formation_energy"
+
+    Returns
+    -------
+      values: numpy.ndarray of float, shape=(n_config, n_values)
+        One row of values per selected configuration, filled directly by libccasm
+
+    """
+    n_config = ctypes.c_ulong(0)
+    n_values = ctypes.c_ulong(0)
+    returncode = API.__api.lib_ccasm.casm_query_size(primclex, six.b(selection), six.b(args), ctypes.byref(n_config), ctypes.byref(n_values))
+    if returncode:
+      raise Exception("Error in casm_query_size: " + str(returncode))
+
+    values = np.zeros((n_config.value, n_values.value), dtype=np.double)
+    returncode = API.__api.lib_ccasm.casm_query_double(primclex, six.b(selection), six.b(args),
+      values.ctypes.data_as(ctypes.POINTER(ctypes.c_double)), values.size)
+    if returncode:
+      raise Exception("Error in casm_query_double: " + str(returncode))
+    return values
+
+  def occupation(self, primclex, selection):
+    """
+    Get the occupation of selected configurations
+
+    Arguments
+    ---------
+
+      primclex: CASM::PrimClex pointer
+        A pointer to a CASM::PrimClex, as obtained from API.primclex_new()
+
+      selection: str
+        "MASTER", "ALL", "CALCULATED", "EMPTY", or a path to a selection file
+
+    Returns
+    -------
+      (occ, offsets): (numpy.ndarray of int, numpy.ndarray of int)
+        The occupation of all selected configurations, concatenated, and offsets
+        of length n_config+1, such that the occupation of the i-th selected
+        configuration is occ[offsets[i]:offsets[i+1]]
+
+    """
+    n_config = ctypes.c_ulong(0)
+    n_sites = ctypes.c_ulong(0)
+    returncode = API.__api.lib_ccasm.casm_occupation_size(primclex, six.b(selection), ctypes.byref(n_config), ctypes.byref(n_sites))
+    if returncode:
+      raise Exception("Error in casm_occupation_size: " + str(returncode))
+
+    occ = np.zeros(n_sites.value, dtype=np.intc)
+    offsets = np.zeros(n_config.value + 1, dtype=np.uint)
+    returncode = API.__api.lib_ccasm.casm_occupation(primclex, six.b(selection),
+      occ.ctypes.data_as(ctypes.POINTER(ctypes.c_int)), occ.size,
+      offsets.ctypes.data_as(ctypes.POINTER(ctypes.c_ulong)), offsets.size)
+    if returncode:
+      raise Exception("Error in casm_occupation: " + str(returncode))
+    return (occ, offsets)
+
 
 def command_list():
     """
@@ -580,3 +667,52 @@ def casm_capture(args, root=None, combine_output=False):
         res = (stdout.decode('utf-8'), stderr.decode('utf-8'), returncode)
 
     return res
+
+def server_command(args, socket_path, cwd=None):
+    """
+    Execute a command via a running 'casm server', which keeps the project
+    loaded between commands
+
+    Arguments
+    ---------
+
+      args: str
+        A string containing the arguments for the casm command to be executed.
+
+          Ex: "casm select --set-on -o /abspath/to/my_selection"
+          Ex: "casm query -k 'configname selected' -v -o STDOUT"
+
+      socket_path: str
+        The path of the socket the server is listening on, by default
+        '$ROOT/.casm/server.sock'
+
+      cwd: str (optional, default=os.getcwd())
+        The directory to execute the command in
+
+    Returns
+    -------
+      (stdout, stderr, returncode): The result of running the command.
+
+    """
+    import socket
+
+    # set default cwd
+    if cwd is None:
+        cwd = os.getcwd()
+
+    sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    try:
+        sock.connect(socket_path)
+        sock.sendall(json.dumps({'args': args, 'cwd': os.path.abspath(cwd)}).encode('utf-8'))
+        sock.shutdown(socket.SHUT_WR)
+        chunks = []
+        while True:
+            chunk = sock.recv(65536)
+            if not chunk:
+                break
+            chunks.append(chunk)
+    finally:
+        sock.close()
+
+    response = json.loads(b''.join(chunks).decode('utf-8'))
+    return (response['stdout'], response['stderr'], response['returncode'])
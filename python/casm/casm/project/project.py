@@ -659,6 +659,41 @@ class Project(object):
       self.__refresh()
       return res
 
+    def query_array(self, args, selection="MASTER"):
+      """
+      Evaluate numeric query properties via the c api, without text output
+
+      Args:
+        args: Query properties, as for 'casm query -k'. Ex: "corr comp formation_energy"
+        selection: "MASTER", "ALL", "CALCULATED", "EMPTY", or a path to a selection file
+
+      Returns
+      -------
+        values: numpy.ndarray of float, with one row per selected configuration
+
+      """
+      # this also ensures self._api is not None
+      data = self.data()
+      return self._api.query_array(data, selection, args)
+
+    def occupation(self, selection="MASTER"):
+      """
+      Get the occupation of selected configurations via the c api
+
+      Args:
+        selection: "MASTER", "ALL", "CALCULATED", "EMPTY", or a path to a selection file
+
+      Returns
+      -------
+        (occ, offsets): The occupation of all selected configurations, concatenated, and
+            offsets such that the occupation of the i-th selected configuration is
+            occ[offsets[i]:offsets[i+1]]
+
+      """
+      # this also ensures self._api is not None
+      data = self.data()
+      return self._api.occupation(data, selection)
+
     @classmethod
     def init(cls, root, verbose=True):
         """ Calls `casm init` to create a new CASM project in the given directory
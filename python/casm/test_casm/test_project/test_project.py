@@ -6,9 +6,10 @@ import unittest
 import os
 from os.path import join
 import json
+import ctypes
 
 import numpy as np
-from casm import project
+from casm import api, project
 
 import test_casm
 from test_casm.test_project import CasmProjectTestCase
@@ -74,4 +75,50 @@ class TestCasmProject(CasmProjectTestCase):
                             np.array([ 2.,  2.,  0.])))
             self.assertTrue(np.allclose(comp_axes.end_members['a'],
                             np.array([ 2.,  0.,  2.])))
-            
+
+    def test_query_array(self):
+        """Test Project.query_array and Project.occupation"""
+        if self.has_projects:
+            proj = project.Project(self.ZrO_dir, verbose=False)
+            proj.capture("select --set-on")
+            sel = project.Selection(proj)
+
+            # compare with 'casm query' output
+            data = project.query(proj, ['scel_size', 'comp_n', 'corr', 'comp'], sel)
+            Nconfig = data.shape[0]
+            corr_comp = [c for c in data.columns if c.startswith('corr(') or c.startswith('comp(')]
+
+            values = proj.query_array("corr comp")
+            self.assertEqual(values.shape, (Nconfig, len(corr_comp)))
+            self.assertTrue(np.allclose(values, data[corr_comp].values, atol=1e-6))
+
+            # ZrO occupation: Zr sites are always 0, and O/Va sites are 1 for O, 0 for Va
+            occ, offsets = proj.occupation()
+            self.assertEqual(offsets.shape, (Nconfig+1,))
+            self.assertEqual(offsets[0], 0)
+            self.assertEqual(offsets[-1], occ.size)
+            for i in range(Nconfig):
+                config_occ = occ[offsets[i]:offsets[i+1]]
+                self.assertEqual(config_occ.size, 4*data['scel_size'][i])
+                self.assertAlmostEqual(config_occ.sum(), data['comp_n(O)'][i]*data['scel_size'][i], places=6)
+
+            # buffers that are too small are an error, not an overflow
+            lib = api.API._API__api.lib_ccasm
+            buf = np.zeros(values.size - 1, dtype=np.double)
+            returncode = lib.casm_query_double(proj.data(), b"MASTER", b"corr comp",
+                buf.ctypes.data_as(ctypes.POINTER(ctypes.c_double)), buf.size)
+            self.assertNotEqual(returncode, 0)
+
+            occ_buf = np.zeros(occ.size, dtype=np.intc)
+            offsets_buf = np.zeros(Nconfig, dtype=np.uint)
+            returncode = lib.casm_occupation(proj.data(), b"MASTER",
+                occ_buf.ctypes.data_as(ctypes.POINTER(ctypes.c_int)), occ_buf.size,
+                offsets_buf.ctypes.data_as(ctypes.POINTER(ctypes.c_ulong)), offsets_buf.size)
+            self.assertNotEqual(returncode, 0)
+
+            occ_buf = np.zeros(occ.size - 1, dtype=np.intc)
+            offsets_buf = np.zeros(Nconfig + 1, dtype=np.uint)
+            returncode = lib.casm_occupation(proj.data(), b"MASTER",
+                occ_buf.ctypes.data_as(ctypes.POINTER(ctypes.c_int)), occ_buf.size,
+                offsets_buf.ctypes.data_as(ctypes.POINTER(ctypes.c_ulong)), offsets_buf.size)
+            self.assertNotEqual(returncode, 0)
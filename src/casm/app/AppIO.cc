@@ -203,6 +203,58 @@ namespace CASM {
     json["character_table"] = grp.character_table();
   }
 
+  /// \brief Read SymGroup tables cached in 'filename'
+  ///
+  /// - The cache is used only if it was written for a group with the same operations,
+  ///   periodicity, and lattice, as checked by SymGroup::tables_hash
+  /// - Returns false, leaving the tables unchanged, if 'filename' does not exist, can not be
+  ///   read, or is not for 'grp'
+  bool read_symgroup_tables(const SymGroup &grp, fs::path filename) {
+    if(!fs::exists(filename)) {
+      return false;
+    }
+    try {
+      return grp.tables_from_json(jsonParser::parse(filename));
+    }
+    catch(std::exception &e) {
+      return false;
+    }
+  }
+
+  /// \brief Write SymGroup tables, generating them if necessary, to 'filename'
+  ///
+  /// - The cache is only an optimization, so errors writing it are not fatal
+  /// - Returns false if 'filename' could not be written
+  bool write_symgroup_tables(const SymGroup &grp, fs::path filename) {
+    jsonParser json;
+    grp.tables_to_json(json);
+
+    try {
+      SafeOfstream outfile;
+      outfile.open(filename);
+      json.print(outfile.ofstream());
+      outfile.close();
+      if(outfile.ofstream().fail()) {
+        fs::remove(filename.string() + ".tmp");
+        return false;
+      }
+      return true;
+    }
+    catch(std::exception &e) {
+      return false;
+    }
+  }
+
+  /// \brief Read SymGroup tables cached in 'filename', or generate them and write the cache
+  ///
+  /// - Returns false if the cache was not up to date and could not be written
+  bool cache_symgroup_tables(const SymGroup &grp, fs::path filename) {
+    if(read_symgroup_tables(grp, filename)) {
+      return true;
+    }
+    return write_symgroup_tables(grp, filename);
+  }
+
 
   // --------- ChemicalReference IO Definitions --------------------------------------------------
 
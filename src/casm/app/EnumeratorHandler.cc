@@ -2,6 +2,8 @@
 #include "casm/clex/ScelEnum_impl.hh"
 #include "casm/clex/ConfigEnumAllOccupations.hh"
 #include "casm/clex/ConfigEnumRandomOccupations.hh"
+#include "casm/clex/ConfigEnumGroundState.hh"
+#include "casm/clex/ConfigEnumStrain.hh"
 #include "casm/clex/SuperConfigEnum.hh"
 
 namespace CASM {
@@ -14,7 +16,9 @@ namespace CASM {
       EnumInterface<ScelEnum>(),
       EnumInterface<ConfigEnumAllOccupations>(),
       EnumInterface<SuperConfigEnum>(),
-      EnumInterface<ConfigEnumRandomOccupations>()
+      EnumInterface<ConfigEnumRandomOccupations>(),
+      EnumInterface<ConfigEnumGroundState>(),
+      EnumInterface<ConfigEnumStrain>()
     );
 
     load_enumerator_plugins(
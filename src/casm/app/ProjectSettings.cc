@@ -605,6 +605,7 @@ namespace CASM {
       fs::remove(m_dir.clexulator_src(name(), *it));
       fs::remove(m_dir.clexulator_o(name(), *it));
       fs::remove(m_dir.clexulator_so(name(), *it));
+      fs::remove(m_dir.clexulator_data(name(), *it));
     }
   }
 
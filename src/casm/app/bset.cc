@@ -24,6 +24,8 @@ namespace CASM {
       ("functions", "Pretty-print prototype cluster functions for each orbit")
       ("clusters", "Pretty-print all clusters")
       ("clex", po::value<std::string>(), "Name of the cluster expansion using the basis set")
+      ("data", "With --update, write basis function data that is evaluated without compiling, "
+       "instead of Clexulator source code. Only occupation basis functions are supported.")
       ("force,f", "Force overwrite");
       return;
     }
@@ -125,7 +127,8 @@ namespace CASM {
                                        dir.basis(bset),
                                        dir.clexulator_src(set.name(), bset),
                                        dir.clexulator_o(set.name(), bset),
-                                       dir.clexulator_so(set.name(), bset)
+                                       dir.clexulator_so(set.name(), bset),
+                                       dir.clexulator_data(set.name(), bset)
                                       });
 
       bool any_existing_files = false;
@@ -147,6 +150,7 @@ namespace CASM {
           fs::remove(dir.clexulator_src(set.name(), bset));
           fs::remove(dir.clexulator_o(set.name(), bset));
           fs::remove(dir.clexulator_so(set.name(), bset));
+          fs::remove(dir.clexulator_data(set.name(), bset));
           if(args.primclex) {
             args.primclex->refresh(false, false, false, false, true);
           }
@@ -223,14 +227,29 @@ namespace CASM {
       neighborhood(std::inserter(nbors, nbors.begin()), tree, prim, primclex.crystallography_tol());
       nlist.expand(nbors.begin(), nbors.end());
 
-      // write source code
-      fs::ofstream outfile;
-      outfile.open(dir.clexulator_src(set.name(), bset));
-      print_clexulator(prim, tree, nlist, set.clexulator(), outfile, primclex.crystallography_tol());
-      outfile.close();
-      args.log << "write: " << dir.clexulator_src(set.name(), bset) << "\n" << std::endl;
+      if(vm.count("data")) {
+        // write basis function data
+        jsonParser data_json;
+        try {
+          write_clexulator_data(prim, tree, nlist, data_json, primclex.crystallography_tol());
+        }
+        catch(std::exception &e) {
+          args.err_log << e.what() << std::endl;
+          return ERR_INVALID_INPUT_FILE;
+        }
+        data_json.write(dir.clexulator_data(set.name(), bset));
+        args.log << "write: " << dir.clexulator_data(set.name(), bset) << "\n" << std::endl;
+      }
+      else {
+        // write source code
+        fs::ofstream outfile;
+        outfile.open(dir.clexulator_src(set.name(), bset));
+        print_clexulator(prim, tree, nlist, set.clexulator(), outfile, primclex.crystallography_tol());
+        outfile.close();
+        args.log << "write: " << dir.clexulator_src(set.name(), bset) << "\n" << std::endl;
+      }
 
-      // compile clexulator
+      // compile or load clexulator
       primclex.clexulator(set.default_clex());
     }
     else if(vm.count("orbits") || vm.count("clusters") || vm.count("functions")) {
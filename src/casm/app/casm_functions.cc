@@ -134,6 +134,7 @@ namespace CASM {
       {"files", files_command},
       {"import", import_command},
       {"monte", monte_command},
+      {"server", server_command},
       {"view", view_command},
       {"help", help_command}
     };
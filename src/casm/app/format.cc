@@ -1623,6 +1623,34 @@ Direct\n\
                "    previous calculation. If false, begin each calculation with the\n" <<
                "    DoF specified for the \"motif\".\n\n" <<
 
+               "  /\"random_seed\": (integer, optional)                           \n\n" <<
+
+               "    Seed for the random number generator. If not given, a seed is  \n" <<
+               "    chosen randomly. The random number generator state at the      \n" <<
+               "    beginning of each calculation is written to                    \n" <<
+               "    \"conditions.i/random.json\", and used again if a calculation  \n" <<
+               "    is restarted.                                                  \n\n" <<
+
+               "  /\"random_stream\": (integer, default 0)                         \n\n" <<
+
+               "    Calculations with the same \"random_seed\" and different        \n" <<
+               "    \"random_stream\" use independent random numbers.              \n\n" <<
+
+               "  /\"checkpoint\": (JSON object, optional)                         \n\n" <<
+
+               "    If given, the state of an unfinished calculation is written     \n" <<
+               "    periodically to \"conditions.i/checkpoint.json\". If a         \n" <<
+               "    calculation is interrupted, it continues from the checkpoint   \n" <<
+               "    when restarted. Checkpoints are written at the end of a pass,  \n" <<
+               "    when either period is exceeded, and removed when the           \n" <<
+               "    calculation is complete.                                       \n\n" <<
+
+               "    /\"passes\": (integer, optional)                               \n" <<
+               "      Number of passes between checkpoints.                        \n\n" <<
+
+               "    /\"time\": (number, optional)                                  \n" <<
+               "      Wall time, in seconds, between checkpoints.                  \n\n" <<
+
 
                "  /\"initial_conditions\",\n" <<
                "  /\"incremental_conditions\", \n" <<
@@ -0,0 +1,442 @@
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "casm/app/casm_functions.hh"
+#include "casm/app/DirectoryStructure.hh"
+#include "casm/app/ProjectSettings.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/casm_io/jsonParser.hh"
+
+#include "casm/completer/Handlers.hh"
+
+namespace CASM {
+
+  namespace Completer {
+
+    ServerOption::ServerOption(): OptionHandlerBase("server") {}
+
+    void ServerOption::initialize() {
+      add_help_suboption();
+
+      m_desc.add_options()
+      ("socket", po::value<fs::path>(&m_socket_path)->value_name(ArgHandler::path()), "Path of the Unix socket. Default: '$ROOT/.casm/server.sock'")
+      ("stop", "Stop the server listening on the socket");
+      return;
+    }
+
+    const fs::path &ServerOption::socket_path() const {
+      return m_socket_path;
+    }
+
+  }
+
+  namespace {
+
+    void _throw_errno(std::string what) {
+      throw std::runtime_error(what + ": " + std::strerror(errno));
+    }
+
+    /// Connect to, or bind, a Unix socket
+    int _socket(const fs::path &path, bool bind_and_listen) {
+      sockaddr_un addr;
+      std::memset(&addr, 0, sizeof(addr));
+      addr.sun_family = AF_UNIX;
+      if(path.string().size() >= sizeof(addr.sun_path)) {
+        throw std::runtime_error("socket path is too long: " + path.string());
+      }
+      std::strcpy(addr.sun_path, path.string().c_str());
+
+      int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+      if(fd < 0) {
+        _throw_errno("could not create socket");
+      }
+      if(bind_and_listen) {
+        // create the socket file accessible only by the owner, with no window in which
+        // others could connect
+        mode_t prev_umask = ::umask(S_IRWXG | S_IRWXO);
+        int result = ::bind(fd, (sockaddr *) &addr, sizeof(addr));
+        ::umask(prev_umask);
+        if(result < 0 || ::listen(fd, 16) < 0) {
+          ::close(fd);
+          _throw_errno("could not listen on " + path.string());
+        }
+      }
+      else if(::connect(fd, (sockaddr *) &addr, sizeof(addr)) < 0) {
+        ::close(fd);
+        _throw_errno("could not connect to " + path.string());
+      }
+      return fd;
+    }
+
+    std::string _read_all(int fd) {
+      std::string result;
+      char buf[4096];
+      ssize_t n;
+      while((n = ::read(fd, buf, sizeof(buf))) != 0) {
+        if(n < 0) {
+          if(errno == EINTR) {
+            continue;
+          }
+          _throw_errno("error reading socket");
+        }
+        result.append(buf, n);
+      }
+      return result;
+    }
+
+    void _write_all(int fd, const std::string &str) {
+      const char *ptr = str.c_str();
+      size_t remaining = str.size();
+      while(remaining) {
+        ssize_t n = ::write(fd, ptr, remaining);
+        if(n < 0) {
+          if(errno == EINTR) {
+            continue;
+          }
+          _throw_errno("error writing socket");
+        }
+        ptr += n;
+        remaining -= n;
+      }
+    }
+
+    std::string _to_string(const jsonParser &json) {
+      std::stringstream ss;
+      json.print(ss);
+      return ss.str();
+    }
+
+    /// Send a request and return the response
+    jsonParser _send(const fs::path &path, const jsonParser &request) {
+      int fd = _socket(path, false);
+      try {
+        _write_all(fd, _to_string(request));
+        ::shutdown(fd, SHUT_WR);
+        jsonParser response = jsonParser::parse(_read_all(fd));
+        ::close(fd);
+        return response;
+      }
+      catch(...) {
+        ::close(fd);
+        throw;
+      }
+    }
+
+    /// Modification time, to the nanosecond, and size of a file
+    ///
+    /// - Seconds alone would miss changes made within the same second as the last read
+    struct FileStamp {
+
+      explicit FileStamp(const fs::path &p) :
+        path(p.string()),
+        sec(0),
+        nsec(0),
+        size(-1) {
+        struct stat st;
+        if(::stat(path.c_str(), &st) == 0) {
+#ifdef __APPLE__
+          sec = st.st_mtimespec.tv_sec;
+          nsec = st.st_mtimespec.tv_nsec;
+#else
+          sec = st.st_mtim.tv_sec;
+          nsec = st.st_mtim.tv_nsec;
+#endif
+          size = st.st_size;
+        }
+      }
+
+      bool operator==(const FileStamp &B) const {
+        return path == B.path && sec == B.sec && nsec == B.nsec && size == B.size;
+      }
+
+      std::string path;
+      long sec;
+      long nsec;
+      long size;
+    };
+
+    typedef std::vector<FileStamp> FileStamps;
+
+    /// Stamps of a directory and everything in it
+    void _stamp_recursive(const fs::path &dir, FileStamps &stamps) {
+      stamps.push_back(FileStamp(dir));
+      if(!fs::is_directory(dir)) {
+        return;
+      }
+      std::vector<fs::path> paths;
+      fs::recursive_directory_iterator it(dir), end;
+      for(; it != end; ++it) {
+        paths.push_back(it->path());
+      }
+      std::sort(paths.begin(), paths.end());
+      for(const auto &p : paths) {
+        stamps.push_back(FileStamp(p));
+      }
+    }
+
+    /// Stamps of the project files read by PrimClex::refresh
+    struct ProjectFileStamps {
+
+      explicit ProjectFileStamps(const PrimClex &primclex) {
+        const DirectoryStructure &dir = primclex.dir();
+        const ClexDescription &desc = primclex.settings().default_clex();
+
+        settings.push_back(FileStamp(dir.project_settings()));
+        composition.push_back(FileStamp(dir.composition_axes()));
+        chem_ref.push_back(FileStamp(dir.chemical_reference(desc.calctype, desc.ref)));
+        configs.push_back(FileStamp(dir.SCEL()));
+        configs.push_back(FileStamp(primclex.get_config_list_path()));
+        for(const auto &bset : dir.all_bset()) {
+          _stamp_recursive(dir.bset_dir(bset), clex);
+        }
+        for(const auto &property : dir.all_property()) {
+          _stamp_recursive(dir.clex_dir(property), clex);
+        }
+      }
+
+      FileStamps settings;
+      FileStamps composition;
+      FileStamps chem_ref;
+      FileStamps configs;
+      FileStamps clex;
+    };
+
+    /// Refresh the PrimClex data that changed on disk since 'prev', and update 'prev'
+    void _refresh_if_changed(PrimClex &primclex, ProjectFileStamps &prev) {
+      ProjectFileStamps curr(primclex);
+      bool read_settings = curr.settings != prev.settings;
+      bool read_composition = curr.composition != prev.composition;
+      bool read_chem_ref = read_settings || curr.chem_ref != prev.chem_ref;
+      bool read_configs = curr.configs != prev.configs;
+      bool clear_clex = read_settings || curr.clex != prev.clex;
+
+      if(read_settings || read_composition || read_chem_ref || read_configs || clear_clex) {
+        primclex.refresh(read_settings, read_composition, read_chem_ref, read_configs, clear_clex);
+        prev = ProjectFileStamps(primclex);
+      }
+    }
+
+    /// Response to a request that could not be executed
+    jsonParser _error_response(int returncode, std::string what) {
+      jsonParser response;
+      response["returncode"] = returncode;
+      response["stdout"] = "";
+      response["stderr"] = "Error: " + what + "\n";
+      return response;
+    }
+
+    /// Execute a request, {"args": "casm ...", "cwd": "/path"}, using the resident PrimClex
+    jsonParser _execute(PrimClex &primclex, const fs::path &root, const jsonParser &request) {
+      OStringStreamLog out_log;
+      OStringStreamLog err_log;
+      Logging logging(out_log, out_log, err_log);
+      Logging prev_logging = static_cast<Logging &>(primclex);
+      static_cast<Logging &>(primclex) = logging;
+
+      fs::path prev_cwd = fs::current_path();
+      int returncode;
+      try {
+        fs::path cwd = request.contains("cwd") ? fs::path(request["cwd"].get<std::string>()) : prev_cwd;
+        fs::current_path(cwd);
+
+        CommandArgs command_args(request["args"].get<std::string>(), &primclex, root, logging);
+        if(command_args.parse_result) {
+          returncode = command_args.parse_result;
+        }
+        else if(command_args.command == "server" || command_args.command == "init") {
+          err_log << "Error: '" << command_args.command << "' can not be run by 'casm server'\n";
+          returncode = ERR_INVALID_ARG;
+        }
+        else {
+          returncode = casm_api(command_args);
+        }
+      }
+      catch(std::exception &e) {
+        err_log << "Error: " << e.what() << "\n";
+        returncode = ERR_UNKNOWN;
+      }
+      fs::current_path(prev_cwd);
+      static_cast<Logging &>(primclex) = prev_logging;
+
+      jsonParser response;
+      response["returncode"] = returncode;
+      response["stdout"] = out_log.ss().str();
+      response["stderr"] = err_log.ss().str();
+      return response;
+    }
+
+  }
+
+  // ///////////////////////////////////////
+  // 'server' function for casm
+  //    (add an 'if-else' statement in casm.cpp to call this)
+
+  int server_command(const CommandArgs &args) {
+
+    po::variables_map vm;
+    fs::path socket_path;
+
+    /// Set command line options using boost program_options
+    Completer::ServerOption server_opt;
+    try {
+      po::store(po::parse_command_line(args.argc, args.argv, server_opt.desc()), vm); // can throw
+
+      /** --help option
+      */
+      if(vm.count("help")) {
+        args.log << "\n";
+        args.log << server_opt.desc() << std::endl;
+
+        return 0;
+      }
+
+      if(vm.count("desc")) {
+        args.log << "\n";
+        args.log << server_opt.desc() << std::endl;
+        args.log << "DESCRIPTION\n"
+                 << "    Keep the project loaded in memory and execute casm commands   \n"
+                 << "    received on a Unix socket, without re-reading the project for \n"
+                 << "    each command. Before each command, project files that have    \n"
+                 << "    changed on disk (project settings, composition axes, chemical \n"
+                 << "    reference, SCEL, config_list, basis sets, and ECI) are re-read.\n\n"
+                 << "    Each request is a JSON object, written to the socket and       \n"
+                 << "    followed by closing the write end of the connection:           \n"
+                 << "      {\"args\": \"casm query -k comp\", \"cwd\": \"/abs/path\"}       \n\n"
+                 << "    'args' is a casm command string, as for the C API, and 'cwd',  \n"
+                 << "    optional, is the directory to run the command in. The response \n"
+                 << "    is a JSON object:                                              \n"
+                 << "      {\"returncode\": 0, \"stdout\": \"...\", \"stderr\": \"...\"}      \n\n"
+                 << "    A request that can not be executed, such as invalid JSON or a  \n"
+                 << "    request without 'args', gets a nonzero 'returncode' and the    \n"
+                 << "    error in 'stderr'.                                             \n\n"
+                 << "    The request {\"stop\": true}, or 'casm server --stop', stops the\n"
+                 << "    server. The 'casm' Python package provides a client:           \n"
+                 << "    'casm.api.server_command'.                                     \n\n"
+                 << "    Example: casm server &                                         \n\n";
+
+        return 0;
+      }
+
+      po::notify(vm); // throws on error, so do after help in case
+      // there are any problems
+    }
+    catch(po::error &e) {
+      args.err_log << "ERROR: " << e.what() << std::endl << std::endl;
+      args.err_log << server_opt.desc() << std::endl;
+      return ERR_INVALID_ARG;
+    }
+    catch(std::exception &e) {
+      args.err_log << "Unhandled Exception reached the top of main: "
+                   << e.what() << ", application will now exit" << std::endl;
+      return ERR_UNKNOWN;
+
+    }
+
+    const fs::path &root = args.root;
+    if(root.empty()) {
+      args.err_log.error("No casm project found");
+      args.err_log << std::endl;
+      return ERR_NO_PROJ;
+    }
+
+    socket_path = vm.count("socket") ? fs::absolute(server_opt.socket_path()) : DirectoryStructure(root).server_socket();
+
+    // a client disconnecting early should not stop the server
+    std::signal(SIGPIPE, SIG_IGN);
+
+    if(vm.count("stop")) {
+      try {
+        jsonParser request;
+        request["stop"] = true;
+        _send(socket_path, request);
+      }
+      catch(std::exception &e) {
+        args.err_log << "ERROR: " << e.what() << std::endl;
+        return ERR_UNKNOWN;
+      }
+      args.log << "Stopped server: " << socket_path << std::endl;
+      return 0;
+    }
+
+    // check for an existing server, and remove a stale socket file
+    if(fs::exists(socket_path)) {
+      try {
+        ::close(_socket(socket_path, false));
+        args.err_log << "ERROR: A server is already listening on " << socket_path << std::endl;
+        return ERR_EXISTING_FILE;
+      }
+      catch(std::exception &e) {
+        fs::remove(socket_path);
+      }
+    }
+
+    std::unique_ptr<PrimClex> uniq_primclex;
+    PrimClex &primclex = make_primclex_if_not(args, uniq_primclex);
+    ProjectFileStamps file_stamps(primclex);
+
+    int server_fd;
+    try {
+      server_fd = _socket(socket_path, true);
+    }
+    catch(std::exception &e) {
+      args.err_log << "ERROR: " << e.what() << std::endl;
+      return ERR_UNKNOWN;
+    }
+    args.log << "Listening on: " << socket_path << "\n" << std::endl;
+
+    bool stop = false;
+    while(!stop) {
+      int fd = ::accept(server_fd, nullptr, nullptr);
+      if(fd < 0) {
+        if(errno == EINTR) {
+          continue;
+        }
+        args.err_log << "ERROR: " << std::strerror(errno) << std::endl;
+        break;
+      }
+
+      // every request gets a response, even if it can not be executed
+      jsonParser response;
+      try {
+        jsonParser request = jsonParser::parse(_read_all(fd));
+        if(request.contains("stop") && request["stop"].get<bool>()) {
+          stop = true;
+          response["returncode"] = 0;
+        }
+        else if(!request.contains("args")) {
+          response = _error_response(ERR_INVALID_ARG, "request has no 'args'");
+        }
+        else {
+          args.log << request["args"].get<std::string>() << std::endl;
+          _refresh_if_changed(primclex, file_stamps);
+          response = _execute(primclex, root, request);
+        }
+      }
+      catch(std::exception &e) {
+        args.err_log << "ERROR: " << e.what() << std::endl;
+        response = _error_response(ERR_INVALID_ARG, e.what());
+      }
+
+      try {
+        _write_all(fd, _to_string(response));
+      }
+      catch(std::exception &e) {
+        args.err_log << "ERROR: " << e.what() << std::endl;
+      }
+      ::close(fd);
+    }
+
+    ::close(server_fd);
+    fs::remove(socket_path);
+    args.log << "Stopped server" << std::endl;
+
+    return 0;
+  }
+
+}
@@ -1,4 +1,5 @@
 #include "casm/CASM_global_definitions.hh"
+#include "casm/app/AppIO.hh"
 #include "casm/app/DirectoryStructure.hh"
 #include "casm/app/ProjectSettings.hh"
 #include "casm/app/casm_functions.hh"
@@ -494,6 +495,7 @@ Instructions for fitting ECI:                                          \n\n\
     // it'd be nice to just read this...
     SymGroup prim_pg;
     primclex.get_prim().lattice().generate_point_group(prim_pg);
+    read_symgroup_tables(prim_pg, primclex.dir().symgroup_tables("lattice_point_group"));
     prim_pg.character_table();
     args.log << "- Lattice point group size: " << prim_pg.size() << std::endl;
     args.log << "- Lattice point group is " << prim_pg.get_name() << std::endl;
@@ -715,7 +717,8 @@ Instructions for fitting ECI:                                          \n\n\
 
     args.log << "6) Generate basis functions: ";
 
-    if(!fs::exists(dir.clexulator_src(settings.name(), bset))) {
+    if(!fs::exists(dir.clexulator_src(settings.name(), bset)) &&
+       !fs::exists(dir.clexulator_data(settings.name(), bset))) {
       args.log << "FALSE\n\n";
 
       if(vm.count("next")) {
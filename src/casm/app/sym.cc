@@ -25,6 +25,17 @@ namespace CASM {
   }
 
 
+  namespace {
+
+    /// \brief Read or write cached SymGroup tables, warning if the cache can not be written
+    void _cache_symgroup_tables(const SymGroup &grp, fs::path filename, const CommandArgs &args) {
+      if(!cache_symgroup_tables(grp, filename)) {
+        args.err_log << "WARNING: Could not write " << filename << ". Continuing anyway.\n" << std::endl;
+      }
+    }
+  }
+
+
   // ///////////////////////////////////////
   // 'sym' function for casm
   //    (add an 'if-else' statement in casm.cpp to call this)
@@ -87,10 +98,12 @@ namespace CASM {
     ProjectSettings set(root);
     Structure prim(read_prim(dir.prim()));
 
+    set.new_symmetry_dir();
+
     args.log << "Generating lattice point group. " << std::endl << std::endl;
     SymGroup prim_pg;
     prim.lattice().generate_point_group(prim_pg, set.crystallography_tol());
-    prim_pg.character_table();
+    _cache_symgroup_tables(prim_pg, dir.symgroup_tables("lattice_point_group"), args);
 
 
     args.log << "  Lattice point group size: " << prim_pg.size() << std::endl;
@@ -100,6 +113,8 @@ namespace CASM {
 
     prim.generate_factor_group(set.crystallography_tol());
     prim.set_site_internals();
+    _cache_symgroup_tables(prim.factor_group(), dir.symgroup_tables("factor_group"), args);
+    _cache_symgroup_tables(prim.point_group(), dir.symgroup_tables("crystal_point_group"), args);
 
     args.log << "  Factor group size: " << prim.factor_group().size() << std::endl;
 
@@ -125,8 +140,6 @@ namespace CASM {
     }
 
     // Write symmetry info files
-    set.new_symmetry_dir();
-
     // Write lattice point group
     {
       fs::ofstream outfile;
@@ -1,6 +1,7 @@
 #include "casm/basis_set/BasisSet.hh"
 
 #include <algorithm>
+#include <set>
 
 #include "casm/misc/CASM_math.hh"
 
@@ -21,6 +22,48 @@
 
 namespace CASM {
 
+  namespace {
+
+    /// \brief Find how each operation of 'head_group' permutes the variables of polynomials of 'tsubs'
+    ///
+    /// - Variables are indexed linearly, as the concatenation of the functions of each BasisSet in 'tsubs'
+    /// - Returns 'perm', such that operation 'ng' maps variable 'i' to a multiple of variable 'perm[ng][i]'
+    /// - Returns an empty vector if any matrix representation is not a signed permutation matrix,
+    ///   in which case operations do not map monomials onto monomials
+    std::vector<std::vector<Index> > _variable_permutations(const Array<BasisSet const *> &tsubs, const SymGroup &head_group) {
+      Array<SymGroupRepID> rep_IDs(tsubs.size());
+      Index N(0);
+      for(Index i = 0; i < tsubs.size(); i++) {
+        rep_IDs[i] = tsubs[i]->basis_symrep_ID();
+        N += tsubs[i]->size();
+      }
+
+      std::vector<std::vector<Index> > perm(head_group.size(), std::vector<Index>(N, -1));
+      for(Index ng = 0; ng < head_group.size(); ng++) {
+        Array<Eigen::SparseMatrix<double> const *> rep_mats(head_group[ng].get_sparse_matrix_reps(rep_IDs));
+        Index linear_offset(0);
+        for(Index ns = 0; ns < tsubs.size(); ns++) {
+          for(Index na1 = 0; na1 < tsubs[ns]->size(); na1++) {
+            // assume identity if no symrep exists
+            if(!rep_mats[ns]) {
+              perm[ng][linear_offset + na1] = linear_offset + na1;
+              continue;
+            }
+            for(Eigen::SparseMatrix<double>::InnerIterator it(*rep_mats[ns], na1); it; ++it) {
+              if(valid_index(perm[ng][linear_offset + na1]))
+                return std::vector<std::vector<Index> >();
+              perm[ng][linear_offset + na1] = linear_offset + it.row();
+            }
+            if(!valid_index(perm[ng][linear_offset + na1]))
+              return std::vector<std::vector<Index> >();
+          }
+          linear_offset += tsubs[ns]->size();
+        }
+      }
+      return perm;
+    }
+  }
+
   //*******************************************************************************************
 
   BasisSet::BasisSet(const BasisSet &init_basis) :
@@ -484,6 +527,14 @@ namespace CASM {
       curr_exp.append(exp_count.back());
     }
 
+    // If every operation maps monomials onto multiples of monomials, the Reynold's operator
+    // gives the same function (up to a constant) for every monomial in an orbit, so only the
+    // first monomial of each orbit needs to be symmetrized. The others would be removed by
+    // Gram_Schmidt anyway.
+    std::vector<std::vector<Index> > var_perm(_variable_permutations(tsubs, head_group));
+    std::set<Array<Index> > visited_exp;
+    Array<Index> equiv_exp(curr_exp.size());
+
     for(; order_count.valid(); ++order_count) {
       for(Index i = 0; i < exp_count.size(); i++)
         exp_count[i].set_sum_constraint(order_count[i]);
@@ -502,6 +553,16 @@ namespace CASM {
         }
         if(!satisfies_exponent_constraints(curr_exp))
           continue;
+
+        if(var_perm.size()) {
+          if(visited_exp.count(curr_exp))
+            continue;
+          for(Index ng = 0; ng < var_perm.size(); ng++) {
+            for(Index nv = 0; nv < curr_exp.size(); nv++)
+              equiv_exp[var_perm[ng][nv]] = curr_exp[nv];
+            visited_exp.insert(equiv_exp);
+          }
+        }
         //else:
         //std::cout << "Adding exponent " << curr_exp << "\n\n";
 
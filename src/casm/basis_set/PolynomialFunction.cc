@@ -435,7 +435,7 @@ namespace CASM {
   Function *PolynomialFunction::transform_monomial_and_add(double prefactor, const Array<Index> &ind, const SymOp &op) {
     assert(ind.size() == m_coeffs.depth() && "\'ind\' Array is not compatible with PolynomialFunction in PolynomialFunction::transform_monomial_and_add");
 
-    Array<Eigen::MatrixXd const *> rep_mats(op.get_matrix_reps(_sub_sym_reps()));
+    Array<Eigen::SparseMatrix<double> const *> rep_mats(op.get_sparse_matrix_reps(_sub_sym_reps()));
     Array<Array<Array<Index> > > exp_counter(m_argument.size(), Array<Array<Index> >());
     Array<Array<Array<Index> > > nz_terms(m_argument.size(), Array<Array<Index> >());
     Array<Array<Array<double> > > nz_coeffs(m_argument.size(), Array<Array<double> >());
@@ -456,18 +456,18 @@ namespace CASM {
         if(!ind[linear_offset + na1])
           continue;
 
-        for(Index na2 = 0; na2 < m_argument[ns]->size(); na2++) {
-          if(rep_mats[ns] && !almost_zero((*rep_mats[ns])(na2, na1))) {
-            nz_terms[ns][na1].push_back(linear_offset + na2);
+        if(rep_mats[ns]) {
+          for(Eigen::SparseMatrix<double>::InnerIterator it(*rep_mats[ns], na1); it; ++it) {
+            nz_terms[ns][na1].push_back(linear_offset + it.row());
             exp_counter[ns][na1].push_back(0);
-            nz_coeffs[ns][na1].push_back((*rep_mats[ns])(na2, na1));
-          }
-          else if(!rep_mats[ns] && na1 == na2) { // assume identity if no symrep exists
-            nz_terms[ns][na1].push_back(linear_offset + na2);
-            exp_counter[ns][na1].push_back(0);
-            nz_coeffs[ns][na1].push_back(1.0);
+            nz_coeffs[ns][na1].push_back(it.value());
           }
         }
+        else { // assume identity if no symrep exists
+          nz_terms[ns][na1].push_back(linear_offset + na1);
+          exp_counter[ns][na1].push_back(0);
+          nz_coeffs[ns][na1].push_back(1.0);
+        }
         exp_counter[ns][na1][0] = ind[linear_offset + na1];
       }
       linear_offset += m_argument[ns]->size();
@@ -568,7 +568,7 @@ namespace CASM {
     typedef MultiCounter<SubspaceCounter> ExpCounter;
 
     assert(transform_flags.size() == m_argument.size());
-    Array<Eigen::MatrixXd const *> rep_mats(op.get_matrix_reps(_sub_sym_reps()));
+    Array<Eigen::SparseMatrix<double> const *> rep_mats(op.get_sparse_matrix_reps(_sub_sym_reps()));
     for(Index i = 0; i < transform_flags.size(); i++) {
       if(!transform_flags[i])
         rep_mats[i] = nullptr;
@@ -584,8 +584,7 @@ namespace CASM {
     // for example, if x^2 transforms to (x-y)^2/2, the end result will be a genericpolynomialfunction that encodes
     // x^2/2-x*y+y^2/2
 
-    // nz_terms and nz_coeffs is basically a sparse depiction of the symrep matrices.  Instead of constructing them here, they
-    // should probably be stored in the symreps themselves and accessed via lazy evaluation.
+    // nz_terms and nz_coeffs are copied from the sparse symrep matrices, which are stored in the symreps themselves
     Index linear_offset(0);
     for(Index ns = 0; ns < m_argument.size(); ns++) {
       exp_counter.push_back(SubspaceCounter());
@@ -601,17 +600,16 @@ namespace CASM {
         }
 
 
-        for(Index na2 = 0; na2 < m_argument[ns]->size(); na2++) {
-          if(rep_mats[ns] && !almost_zero((*rep_mats[ns])(na2, na1))) {
-            //nz_flag = true; // indicate that this variable can transform into something else
-            nz_terms[ns][na1].push_back(linear_offset + na2);
-            nz_coeffs[ns][na1].push_back((*rep_mats[ns])(na2, na1));
-          }
-          else if(!rep_mats[ns] && na1 == na2) { // assume identity if no symrep exists
-            nz_terms[ns][na1].push_back(linear_offset + na2);
-            nz_coeffs[ns][na1].push_back(1.0);
+        if(rep_mats[ns]) {
+          for(Eigen::SparseMatrix<double>::InnerIterator it(*rep_mats[ns], na1); it; ++it) {
+            nz_terms[ns][na1].push_back(linear_offset + it.row());
+            nz_coeffs[ns][na1].push_back(it.value());
           }
         }
+        else { // assume identity if no symrep exists
+          nz_terms[ns][na1].push_back(linear_offset + na1);
+          nz_coeffs[ns][na1].push_back(1.0);
+        }
         exp_counter[ns].push_back(TermCounter(Array<Index>(nz_terms[ns][na1].size(), 0),
                                               Array<Index>(nz_terms[ns][na1].size(), pow_to_distribute),
                                               1, pow_to_distribute));
@@ -1,4 +1,5 @@
 #include "casm/casm_io/jsonParser.hh"
+#include "casm/casm_io/jsonStream.hh"
 #include "casm/misc/CASM_math.hh"
 
 namespace CASM {
@@ -162,8 +163,97 @@ namespace CASM {
 
   // ---- Read/Print JSON  ----------------------------------
 
+  namespace {
+
+    /// Builds a json_spirit::mValue from jsonStreamReader callbacks
+    class DOMBuilder {
+
+    public:
+
+      DOMBuilder(json_spirit::mValue &value) :
+        m_value(value) {}
+
+      void null_value() {
+        _add(json_spirit::mValue());
+      }
+
+      void bool_value(bool value) {
+        _add(json_spirit::mValue(value));
+      }
+
+      void int_value(boost::int64_t value) {
+        _add(json_spirit::mValue(value));
+      }
+
+      void uint_value(boost::uint64_t value) {
+        _add(json_spirit::mValue(value));
+      }
+
+      void real_value(double value) {
+        _add(json_spirit::mValue(value));
+      }
+
+      void string_value(std::string &value) {
+        _add(json_spirit::mValue(value));
+      }
+
+      void key(std::string &name) {
+        m_key.swap(name);
+      }
+
+      void begin_object() {
+        m_stack.push_back(&_add(json_spirit::mValue(json_spirit::mObject())));
+      }
+
+      void end_object() {
+        m_stack.pop_back();
+      }
+
+      void begin_array() {
+        m_stack.push_back(&_add(json_spirit::mValue(json_spirit::mArray())));
+      }
+
+      void end_array() {
+        m_stack.pop_back();
+      }
+
+    private:
+
+      /// Add a value to the current object or array, and return a reference to it
+      json_spirit::mValue &_add(const json_spirit::mValue &value) {
+        if(m_stack.empty()) {
+          return m_value = value;
+        }
+        json_spirit::mValue &parent = *m_stack.back();
+        if(parent.type() == json_spirit::array_type) {
+          parent.get_array().push_back(value);
+          return parent.get_array().back();
+        }
+        return parent.get_obj()[m_key] = value;
+      }
+
+      json_spirit::mValue &m_value;
+
+      /// Objects and arrays currently being read
+      std::vector<json_spirit::mValue *> m_stack;
+
+      /// Name of the next object member
+      std::string m_key;
+
+    };
+  }
+
+  /// Reads JSON using jsonStreamReader, which accepts the same input as json_spirit but
+  /// reads directly from the stream buffer rather than through a multi_pass iterator
   bool jsonParser::read(std::istream &stream) {
-    return json_spirit::read_stream(stream, (json_spirit::mValue &) * this);
+    try {
+      DOMBuilder builder((json_spirit::mValue &) * this);
+      read_json_stream(stream, builder);
+      return true;
+    }
+    catch(std::runtime_error &e) {
+      return false;
+    }
   }
 
   bool jsonParser::read(const boost::filesystem::path &file_path) {
@@ -0,0 +1,77 @@
+#include "casm/clex/CompactOccupation.hh"
+
+#include "casm/clex/Supercell.hh"
+
+namespace CASM {
+
+  namespace {
+
+    std::vector<int> _sublat_n_occupants(const Supercell &scel) {
+      std::vector<int> result;
+      for(const auto &site : scel.get_prim().basis) {
+        result.push_back(site.allowed_occupants().size());
+      }
+      return result;
+    }
+
+  }
+
+  CompactOccupation::CompactOccupation(const std::vector<int> &sublat_n_occupants, Index volume) {
+
+    if(volume < 1) {
+      throw std::runtime_error("Error in CompactOccupation: volume must be >= 1");
+    }
+
+    std::shared_ptr<Layout> layout = std::make_shared<Layout>();
+    layout->volume = volume;
+    layout->size = volume * sublat_n_occupants.size();
+
+    Index total = 0;
+    for(int n : sublat_n_occupants) {
+      if(n < 1) {
+        throw std::runtime_error("Error in CompactOccupation: each sublattice must have >= 1 allowed occupant");
+      }
+
+      // smallest power of two number of bits that can store 0..n-1
+      int bits = 0;
+      while((Index(1) << bits) < n) {
+        bits = bits ? 2 * bits : 1;
+      }
+      // align the sublattice to its field width, so that no site spans two words
+      if(bits) {
+        total = (total + bits - 1) / bits * bits;
+      }
+
+      layout->bits.push_back(bits);
+      layout->offset.push_back(total);
+      layout->mask.push_back(bits ? (~word_type(0)) >> (word_bits - bits) : 0);
+      total += bits * volume;
+    }
+
+    m_layout = layout;
+
+    // at least one word, so that sites with no bits may still be read
+    m_data.resize(total / word_bits + 1, 0);
+  }
+
+  CompactOccupation::CompactOccupation(const Supercell &scel) :
+    CompactOccupation(_sublat_n_occupants(scel), scel.volume()) {}
+
+  ReturnArray<int> CompactOccupation::occupation() const {
+    Array<int> result(size());
+    for(Index l = 0; l < size(); l++) {
+      result[l] = occ(l);
+    }
+    return result;
+  }
+
+  void CompactOccupation::set_occupation(const Array<int> &_occupation) {
+    if(_occupation.size() != size()) {
+      throw std::runtime_error("Error in CompactOccupation::set_occupation: size mismatch");
+    }
+    for(Index l = 0; l < size(); l++) {
+      set_occ(l, _occupation[l]);
+    }
+  }
+
+}
@@ -238,6 +238,75 @@ namespace CASM {
     return correlations;
   }
 
+  /// \brief Returns correlations using 'clexulator', by updating the correlations of a reference ConfigDoF
+  ///
+  /// \param configdof The ConfigDoF to calculate correlations for
+  /// \param ref_configdof A reference ConfigDoF in the same Supercell
+  /// \param ref_corr The correlations of 'ref_configdof', as calculated by 'correlations'
+  /// \param scel The Supercell, which needs a correctly populated neighbor list
+  /// \param clexulator The Clexulator
+  ///
+  /// Only the contributions from unit cells whose neighborhood includes a site
+  /// with an occupant that differs from 'ref_configdof' are evaluated, so this
+  /// is much faster than 'correlations' for a few changes in a large Supercell,
+  /// such as a dilute defect relative to a fixed background.
+  ///
+  Correlation correlations(const ConfigDoF &configdof,
+                           const ConfigDoF &ref_configdof,
+                           const Correlation &ref_corr,
+                           const Supercell &scel,
+                           Clexulator &clexulator) {
+
+    if(configdof.size() != ref_configdof.size()) {
+      throw std::runtime_error("Error in correlations: ConfigDoF and reference ConfigDoF are not the same size");
+    }
+
+    // The neighbor list neighborhood is symmetric, so the unit cells whose
+    // neighborhood includes site 'l' are the neighbors of the unit cell of 'l'
+    const SuperNeighborList &nlist = scel.nlist();
+    std::set<Index> unitcells;
+    for(Index l = 0; l < configdof.size(); l++) {
+      if(configdof.occ(l) != ref_configdof.occ(l)) {
+        const auto &nbors = nlist.unitcells(nlist.unitcell_index(l));
+        unitcells.insert(nbors.begin(), nbors.end());
+      }
+    }
+
+    //Size of the supercell will be used for normalizing correlations to a per primitive cell value
+    int scel_vol = scel.volume();
+
+    Correlation correlations = ref_corr * scel_vol;
+
+    //Holds contribution to global correlations from a particular neighborhood
+    std::vector<double> tcorr(clexulator.corr_size(), 0.0);
+
+    // remove reference contributions, then add new contributions
+    clexulator.set_config_occ(ref_configdof.occupation().begin());
+    for(Index v : unitcells) {
+      clexulator.set_nlist(nlist.sites(v).data());
+      clexulator.calc_global_corr_contribution(&tcorr[0]);
+      for(int i = 0; i < tcorr.size(); i++) {
+        correlations[i] -= tcorr[i];
+      }
+    }
+
+    clexulator.set_config_occ(configdof.occupation().begin());
+    for(Index v : unitcells) {
+      clexulator.set_nlist(nlist.sites(v).data());
+      clexulator.calc_global_corr_contribution(&tcorr[0]);
+      for(int i = 0; i < tcorr.size(); i++) {
+        correlations[i] += tcorr[i];
+      }
+    }
+
+    // normalize by supercell volume
+    for(int i = 0; i < clexulator.corr_size(); i++) {
+      correlations[i] /= (double) scel_vol;
+    }
+
+    return correlations;
+  }
+
   /// \brief Returns correlations using 'clexulator'. Supercell needs a correctly populated neighbor list.
   Eigen::VectorXd correlations_vec(const ConfigDoF &configdof, const Supercell &scel, Clexulator &clexulator) {
 
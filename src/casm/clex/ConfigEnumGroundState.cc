@@ -0,0 +1,516 @@
+#include "casm/clex/ConfigEnumGroundState.hh"
+#include "casm/clex/Supercell.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/clex/ScelEnum.hh"
+#include "casm/clex/FilteredConfigIterator.hh"
+#include "casm/app/ProjectSettings.hh"
+#include "casm/container/Enumerator_impl.hh"
+
+extern "C" {
+  CASM::EnumInterfaceBase *make_ConfigEnumGroundState_interface() {
+    return new CASM::EnumInterface<CASM::ConfigEnumGroundState>();
+  }
+}
+
+namespace CASM {
+
+  namespace {
+
+    /// Terms with at most this many completions of their unassigned sites are
+    /// bounded exactly, otherwise by their unconstrained minimum
+    const Index max_bound_combinations = 64;
+
+    /// Number of occupations of 'site', given the number of allowed occupants
+    /// on each site
+    template<typename SiteIterator>
+    Index n_combinations(SiteIterator begin, SiteIterator end, const std::vector<std::vector<double> > &site_pot, Index max) {
+      Index n = 1;
+      for(auto it = begin; it != end; ++it) {
+        n *= site_pot[*it].size();
+        if(n > max) {
+          return max + 1;
+        }
+      }
+      return n;
+    }
+  }
+
+  const std::string ConfigEnumGroundState::enumerator_name = "ConfigEnumGroundState";
+
+  const std::string ConfigEnumGroundState::interface_help =
+    "ConfigEnumGroundState: \n\n"
+
+    "  supercells: ScelEnum JSON settings (default='{\"existing_only\"=true}')\n"
+    "    Indicate supercells to find the ground state in. May be a JSON array of  \n"
+    "    supercell names, or a JSON object specifying supercells in terms of size \n"
+    "    and unit cell. By default, all existing supercells are used. See         \n"
+    "    'ScelEnum' description for details.                                  \n\n"
+
+    "  clex: string (optional, default=default cluster expansion)\n"
+    "    Name of the cluster expansion whose basis set and ECI are used to        \n"
+    "    evaluate the energy. See 'casm settings -l'.                         \n\n"
+
+    "  param_chem_pot: JSON object (optional, default=0.0 for all)\n"
+    "    Parametric chemical potentials, i.e. {\"a\": -0.1, \"b\": 0.2}. The       \n"
+    "    potential energy, 'clex - param_chem_pot*comp_x', is minimized. Requires \n"
+    "    composition axes to be set if given.                                 \n\n"
+
+    "  max_time: number (optional, default=3600.0)\n"
+    "    Maximum time, in seconds, spent searching in each supercell. If exceeded \n"
+    "    the best configuration found so far is saved, but it is not guaranteed  \n"
+    "    to be the ground state.                                              \n\n"
+
+    "  max_nodes: integer (optional, default=100000000)\n"
+    "    Maximum number of search tree nodes visited in each supercell. If        \n"
+    "    exceeded the best configuration found so far is saved, but it is not    \n"
+    "    guaranteed to be the ground state.                                   \n\n"
+
+    "  max_term_size: integer (optional, default=1000000)\n"
+    "    Maximum number of occupations of the sites involved in one orbit of      \n"
+    "    basis functions. Lower bounds require minimizing each orbit's            \n"
+    "    contribution over all such occupations, so very large clusters or        \n"
+    "    multi-component systems may require increasing this.                 \n\n"
+
+    "  primitive_only: bool (default=true)\n"
+    "    If true, only the primitive form of a configuration is saved in the      \n"
+    "    configuration list. Otherwise, both primitive and non-primitive          \n"
+    "    configurations are saved. \n\n"
+
+    "  filter: string (optional, default=None)\n"
+    "    A query command to use to filter which Configurations are kept.          \n\n"
+
+    "  Notes:\n"
+    "    The search uses depth-first branch-and-bound over site occupations, with \n"
+    "    lower bounds obtained by minimizing the contribution from each unit cell \n"
+    "    and orbit of basis functions independently. The enumeration source of   \n"
+    "    each result records whether the search completed ('is_optimal'), its     \n"
+    "    potential energy per unit cell, and the number of nodes visited.     \n\n"
+
+    "  Examples:\n"
+    "    To find the ground state in supercells of size 4 through 8:\n"
+    "      casm enum --method ConfigEnumGroundState -i \n"
+    "        '{\"supercells\":{\"min\":4, \"max\":8}}' \n"
+    "\n"
+    "    To find the ground state in all existing supercells at a particular   \n"
+    "    parametric chemical potential:\n"
+    "      casm enum --method ConfigEnumGroundState -i \n"
+    "        '{\"param_chem_pot\": {\"a\": -0.1}}' \n\n";
+
+  int ConfigEnumGroundState::run(
+    PrimClex &primclex,
+    const jsonParser &_kwargs,
+    const Completer::EnumOption &enum_opt) {
+
+    std::unique_ptr<ScelEnum> scel_enum = make_enumerator_scel_enum(primclex, _kwargs, enum_opt);
+    std::vector<std::string> filter_expr = make_enumerator_filter_expr(_kwargs, enum_opt);
+
+    ClexDescription desc = primclex.settings().default_clex();
+    if(_kwargs.contains("clex")) {
+      desc = primclex.settings().clex(_kwargs["clex"].get<std::string>());
+    }
+    if(!primclex.has_clexulator(desc)) {
+      throw std::runtime_error("Error in ConfigEnumGroundState: No basis functions found for "
+                               "cluster expansion '" + desc.name + "'. Try 'casm bset -u'.");
+    }
+    if(!primclex.has_eci(desc)) {
+      throw std::runtime_error("Error in ConfigEnumGroundState: No ECI found for "
+                               "cluster expansion '" + desc.name + "'.");
+    }
+    Clexulator clexulator = primclex.clexulator(desc);
+    const ECIContainer &eci = primclex.eci(desc);
+
+    // chem_pot(i) of each component, or empty if not given
+    Eigen::VectorXd chem_pot;
+    if(_kwargs.contains("param_chem_pot")) {
+      if(!primclex.has_composition_axes()) {
+        throw std::runtime_error("Error in ConfigEnumGroundState: 'param_chem_pot' given, "
+                                 "but no composition axes are selected.");
+      }
+      const CompositionConverter &comp_axes = primclex.composition_axes();
+      Eigen::VectorXd param_chem_pot = Eigen::VectorXd::Zero(comp_axes.independent_compositions());
+      for(int i = 0; i < param_chem_pot.size(); i++) {
+        _kwargs["param_chem_pot"].get_if(param_chem_pot(i), CompositionConverter::comp_var(i));
+      }
+      chem_pot = comp_axes.dparam_dmol().transpose() * param_chem_pot;
+    }
+
+    double max_time;
+    _kwargs.get_else<double>(max_time, "max_time", 3600.0);
+
+    Index max_nodes;
+    _kwargs.get_else<Index>(max_nodes, "max_nodes", 100000000);
+
+    Index max_term_size;
+    _kwargs.get_else<Index>(max_term_size, "max_term_size", 1000000);
+
+    bool primitive_only = true;
+    _kwargs.get_if(primitive_only, "primitive_only");
+
+    auto lambda = [&](Supercell & scel) {
+      return notstd::make_unique<ConfigEnumGroundState>(
+               scel, clexulator, eci, chem_pot, max_time, max_nodes, max_term_size);
+    };
+
+    int returncode = insert_configs(
+                       enumerator_name,
+                       primclex,
+                       scel_enum->begin(),
+                       scel_enum->end(),
+                       lambda,
+                       filter_expr,
+                       primitive_only);
+
+    return returncode;
+  }
+
+  /// \brief Construct with a Supercell, Clexulator, and ECI
+  ///
+  /// \param _scel Supercell to find the ground state in
+  /// \param _clexulator Clexulator used to evaluate the basis functions
+  /// \param _eci ECI
+  /// \param _chem_pot Chemical potential of each component, as ordered by
+  ///        CompositionConverter::components, or empty for none
+  /// \param _max_time,_max_nodes Search limits
+  /// \param _max_term_size Maximum number of occupations of the sites of one
+  ///        orbit allowed when calculating its minimum contribution
+  ///
+  /// - The search is performed during construction
+  ConfigEnumGroundState::ConfigEnumGroundState(
+    Supercell &_scel,
+    const Clexulator &_clexulator,
+    const ECIContainer &_eci,
+    const Eigen::VectorXd &_chem_pot,
+    double _max_time,
+    Index _max_nodes,
+    Index _max_term_size) :
+    m_scel(&_scel),
+    m_clexulator(_clexulator),
+    m_max_nodes(_max_nodes),
+    m_max_time(_max_time),
+    m_max_term_size(_max_term_size),
+    m_occ(_scel.num_sites(), 0),
+    m_tcorr(_clexulator.corr_size(), 0.0),
+    m_best_value(std::numeric_limits<double>::max()),
+    m_n_nodes(0),
+    m_is_optimal(false),
+    m_stop(false) {
+
+    m_clexulator.set_config_occ(m_occ.begin());
+    _init_terms(_eci, _chem_pot);
+
+    // initial bound, with all sites that have a choice of occupant unassigned
+    m_bound = 0.0;
+    for(auto &term : m_term) {
+      term.bound = _term_bound(term);
+      m_bound += term.bound;
+    }
+    for(Index l = 0; l < m_site_min_pot.size(); ++l) {
+      m_bound += m_site_min_pot[l];
+    }
+
+    m_undo.resize(m_order.size());
+    m_start_time = boost::chrono::steady_clock::now();
+    _search(0);
+    m_is_optimal = !m_stop;
+
+    m_current = notstd::make_cloneable<Configuration>(_scel, this->source(0));
+    m_current->set_occupation(m_best_occ);
+    reset_properties(*m_current);
+    this->_initialize(&(*m_current));
+    _set_step(0);
+    _current().set_source(this->source(step()));
+  }
+
+  /// \brief Includes the search results in the source
+  ///
+  /// Returns:
+  /// \code
+  /// {
+  ///   "enumerated_by": "ConfigEnumGroundState",
+  ///   "step": <step #>,
+  ///   "is_optimal": <bool>,
+  ///   "potential_energy": <number>,
+  ///   "n_nodes": <integer>
+  /// }
+  /// \endcode
+  jsonParser ConfigEnumGroundState::source(step_type step) const {
+    jsonParser src = InputEnumeratorBase<Configuration>::source(step);
+    src["is_optimal"] = is_optimal();
+    src["potential_energy"] = potential_energy();
+    src["n_nodes"] = n_nodes();
+    return src;
+  }
+
+  /// \brief Potential energy of the result, per unit cell
+  double ConfigEnumGroundState::potential_energy() const {
+    return m_best_value / m_scel->volume();
+  }
+
+  /// Only one Configuration is enumerated
+  void ConfigEnumGroundState::increment() {
+    this->_invalidate();
+  }
+
+  /// \brief Construct TermGroup and Term, and the per site data
+  ///
+  /// - Basis functions are grouped by neighborhood, which is shared by all
+  ///   basis functions of an orbit
+  void ConfigEnumGroundState::_init_terms(const ECIContainer &_eci, const Eigen::VectorXd &_chem_pot) {
+
+    const Structure &prim = m_scel->get_prim();
+    Index N_sites = m_scel->num_sites();
+
+    // per site chemical potential terms
+    std::vector<std::vector<Index> > to_component;
+    if(_chem_pot.size()) {
+      to_component = get_index_converter(prim, m_scel->get_primclex().composition_axes().components());
+    }
+    m_site_pot.resize(N_sites);
+    m_site_min_pot.resize(N_sites);
+    m_site_term.resize(N_sites);
+    m_assigned.resize(N_sites);
+    for(Index l = 0; l < N_sites; ++l) {
+      Index b = m_scel->get_b(l);
+      m_site_pot[l].resize(prim.basis[b].site_occupant().size(), 0.0);
+      if(_chem_pot.size()) {
+        for(Index occ = 0; occ < m_site_pot[l].size(); ++occ) {
+          m_site_pot[l][occ] = -_chem_pot(to_component[b][occ]);
+        }
+      }
+      m_site_min_pot[l] = *std::min_element(m_site_pot[l].begin(), m_site_pot[l].end());
+      m_assigned[l] = (m_site_pot[l].size() == 1);
+    }
+
+    // assign sites unit cell by unit cell, so that terms are completed early
+    for(Index v = 0; v < m_scel->volume(); ++v) {
+      for(Index b = 0; b < prim.basis.size(); ++b) {
+        Index l = b * m_scel->volume() + v;
+        if(!m_assigned[l]) {
+          m_order.push_back(l);
+        }
+      }
+    }
+
+    // group basis functions by neighborhood
+    std::map<std::set<UnitCellCoord>, Index> group_index;
+    for(Index i = 0; i < _eci.size(); ++i) {
+      if(_eci.value()[i] == 0.0) {
+        continue;
+      }
+      auto j = _eci.index()[i];
+      auto res = group_index.insert(std::make_pair(m_clexulator.neighborhood(j), m_group.size()));
+      if(res.second) {
+        m_group.push_back(TermGroup());
+      }
+      m_group[res.first->second].corr_ind.push_back(j);
+      m_group[res.first->second].eci.push_back(_eci.value()[i]);
+    }
+
+    // construct the terms of each unit cell
+    for(const auto &val : group_index) {
+      for(Index v = 0; v < m_scel->volume(); ++v) {
+        Term term;
+        term.unitcell = v;
+        term.group = val.second;
+        std::set<Index> site;
+        UnitCell uc = m_scel->uccoord(v).unitcell();
+        for(const auto &uccoord : val.first) {
+          site.insert(m_scel->find(uccoord + uc));
+        }
+        term.n_unassigned = 0;
+        for(Index l : site) {
+          if(!m_assigned[l]) {
+            term.site.push_back(l);
+            ++term.n_unassigned;
+            m_site_term[l].push_back(m_term.size());
+          }
+        }
+        m_term.push_back(term);
+      }
+    }
+
+    // unconstrained minimum of each group, by translational symmetry the same
+    // for all unit cells of the supercell
+    // - m_term is ordered by neighborhood, not by group index, so use the first
+    //   term of each group
+    for(const auto &term : m_term) {
+      if(term.unitcell != 0) {
+        continue;
+      }
+      if(n_combinations(term.site.begin(), term.site.end(), m_site_pot, m_max_term_size) > m_max_term_size) {
+        throw std::runtime_error(
+          "Error in ConfigEnumGroundState: Too many occupations of the sites of an orbit "
+          "to bound its contribution. Try increasing 'max_term_size'.");
+      }
+      m_group[term.group].min_value = _term_min(term, term.site);
+    }
+  }
+
+  /// \brief Evaluate a term using the current occupation
+  double ConfigEnumGroundState::_term_value(const Term &term) {
+    const TermGroup &group = m_group[term.group];
+    m_clexulator.set_nlist(m_scel->nlist().sites(term.unitcell).data());
+    m_clexulator.calc_restricted_global_corr_contribution(
+      m_tcorr.data(),
+      group.corr_ind.data(),
+      group.corr_ind.data() + group.corr_ind.size());
+
+    double value = 0.0;
+    for(Index i = 0; i < group.corr_ind.size(); ++i) {
+      value += group.eci[i] * m_tcorr[group.corr_ind[i]];
+    }
+    return value;
+  }
+
+  /// \brief Minimum of a term over all occupations of the sites in 'free'
+  ///
+  /// - The occupation of the sites in 'free' is restored before returning
+  double ConfigEnumGroundState::_term_min(const Term &term, const std::vector<Index> &free) {
+
+    std::vector<int> init(free.size());
+    for(Index i = 0; i < free.size(); ++i) {
+      init[i] = m_occ[free[i]];
+      m_occ[free[i]] = 0;
+    }
+
+    double min_value = _term_value(term);
+    Index i = 0;
+    while(i < free.size()) {
+      if(m_occ[free[i]] + 1 < m_site_pot[free[i]].size()) {
+        ++m_occ[free[i]];
+        i = 0;
+        min_value = std::min(min_value, _term_value(term));
+      }
+      else {
+        m_occ[free[i]] = 0;
+        ++i;
+      }
+    }
+
+    for(Index i = 0; i < free.size(); ++i) {
+      m_occ[free[i]] = init[i];
+    }
+    return min_value;
+  }
+
+  /// \brief Lower bound of a term given the currently assigned sites
+  double ConfigEnumGroundState::_term_bound(const Term &term) {
+    if(term.n_unassigned == 0) {
+      return _term_value(term);
+    }
+
+    std::vector<Index> free;
+    free.reserve(term.n_unassigned);
+    for(Index l : term.site) {
+      if(!m_assigned[l]) {
+        free.push_back(l);
+      }
+    }
+    if(n_combinations(free.begin(), free.end(), m_site_pot, max_bound_combinations) > max_bound_combinations) {
+      return m_group[term.group].min_value;
+    }
+    return _term_min(term, free);
+  }
+
+  /// \brief Assign a site, updating the bound
+  void ConfigEnumGroundState::_assign(Index depth, int occ) {
+    Index l = m_order[depth];
+    m_occ[l] = occ;
+    m_assigned[l] = true;
+    m_bound += m_site_pot[l][occ] - m_site_min_pot[l];
+
+    auto &undo = m_undo[depth];
+    undo.clear();
+    for(Index t : m_site_term[l]) {
+      Term &term = m_term[t];
+      --term.n_unassigned;
+      undo.push_back(std::make_pair(t, term.bound));
+      term.bound = _term_bound(term);
+      m_bound += term.bound - undo.back().second;
+    }
+  }
+
+  /// \brief Unassign a site, restoring the previous bound
+  void ConfigEnumGroundState::_unassign(Index depth) {
+    Index l = m_order[depth];
+    for(const auto &val : m_undo[depth]) {
+      Term &term = m_term[val.first];
+      ++term.n_unassigned;
+      m_bound += val.second - term.bound;
+      term.bound = val.second;
+    }
+    m_bound -= m_site_pot[l][m_occ[l]] - m_site_min_pot[l];
+    m_assigned[l] = false;
+  }
+
+  /// \brief Depth-first branch-and-bound
+  ///
+  /// - Children are visited in order of increasing lower bound, so the first
+  ///   leaf reached is a greedy solution
+  void ConfigEnumGroundState::_search(Index depth) {
+
+    ++m_n_nodes;
+
+    if(depth == m_order.size()) {
+
+      // evaluate exactly, rather than using the accumulated bound
+      double value = 0.0;
+      for(const auto &term : m_term) {
+        value += term.bound;
+      }
+      for(Index l = 0; l < m_occ.size(); ++l) {
+        value += m_site_pot[l][m_occ[l]];
+      }
+
+      if(value < m_best_value) {
+        m_best_value = value;
+        m_best_occ = m_occ;
+      }
+      return;
+    }
+
+    if(_limit_exceeded()) {
+      m_stop = true;
+      return;
+    }
+
+    Index l = m_order[depth];
+    std::vector<std::pair<double, int> > child(m_site_pot[l].size());
+    for(int occ = 0; occ < child.size(); ++occ) {
+      _assign(depth, occ);
+      child[occ] = std::make_pair(m_bound, occ);
+      _unassign(depth);
+    }
+    std::sort(child.begin(), child.end());
+
+    for(const auto &val : child) {
+      if(val.first >= m_best_value - TOL) {
+        break;
+      }
+      _assign(depth, val.second);
+      _search(depth + 1);
+      _unassign(depth);
+      if(m_stop) {
+        return;
+      }
+    }
+  }
+
+  /// \brief True if the node or time limit was exceeded
+  ///
+  /// - Never true before a first solution is found
+  bool ConfigEnumGroundState::_limit_exceeded() {
+    if(!m_best_occ.size()) {
+      return false;
+    }
+    if(m_n_nodes > m_max_nodes) {
+      return true;
+    }
+    if(m_n_nodes % 1000 == 0) {
+      boost::chrono::duration<double> elapsed = boost::chrono::steady_clock::now() - m_start_time;
+      return elapsed.count() > m_max_time;
+    }
+    return false;
+  }
+
+}
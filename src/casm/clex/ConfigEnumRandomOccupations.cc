@@ -2,6 +2,7 @@
 #include "casm/container/Enumerator_impl.hh"
 #include "casm/clex/ScelEnum.hh"
 #include "casm/external/MersenneTwister/MersenneTwister.h"
+#include "casm/misc/PhiloxRand.hh"
 #include "casm/clex/FilteredConfigIterator.hh"
 
 extern "C" {
@@ -35,6 +36,10 @@ namespace CASM {
     "  filter: string (optional, default=None)\n"
     "    A query command to use to filter which Configurations are kept.          \n\n"
 
+    "  seed: integer (optional, default=random)\n"
+    "    Seed for the random number generator. The seed used is printed, so that  \n"
+    "    the same configurations can be generated again.                          \n\n"
+
     "  Examples:\n"
     "    To enumerate 200 random occupations in supercells up to and including size 4:\n"
     "      casm enum --method ConfigEnumRandomOccupations -i \n"
@@ -66,7 +71,16 @@ namespace CASM {
 
     std::unique_ptr<ScelEnum> scel_enum = make_enumerator_scel_enum(primclex, _kwargs, enum_opt);
     std::vector<std::string> filter_expr = make_enumerator_filter_expr(_kwargs, enum_opt);
-    MTRand mtrand;
+    PhiloxRand::uint64 seed;
+    if(_kwargs.contains("seed")) {
+      seed = _kwargs["seed"].get<PhiloxRand::uint64>();
+    }
+    else {
+      MTRand mtrand;
+      seed = (PhiloxRand::uint64(mtrand.randInt()) << 32) + mtrand.randInt();
+    }
+    PhiloxRand random(seed);
+    primclex.log() << "Random number generator seed: " << seed << "\n" << std::endl;
 
     Index n_config;
     _kwargs.get_else<Index>(n_config, "n_config", 100);
@@ -76,7 +90,7 @@ namespace CASM {
 
 
     auto lambda = [&](Supercell & scel) {
-      return notstd::make_unique<ConfigEnumRandomOccupations>(scel, n_config, mtrand);
+      return notstd::make_unique<ConfigEnumRandomOccupations>(scel, n_config, random);
     };
 
     int returncode = insert_configs(
@@ -103,9 +117,9 @@ namespace CASM {
   ConfigEnumRandomOccupations::ConfigEnumRandomOccupations(
     Supercell &_scel,
     Index _n_config,
-    MTRand &_mtrand):
+    std::function<int (int)> _random_occ):
     m_n_config(_n_config),
-    m_mtrand(&_mtrand),
+    m_random_occ(_random_occ),
     m_max_allowed(_scel.max_allowed_occupation()) {
 
     if(m_n_config < 0) {
@@ -144,7 +158,7 @@ namespace CASM {
 
   void ConfigEnumRandomOccupations::randomize() {
     for(Index i = 0; i < m_current->size(); ++i) {
-      m_current->set_occ(i, m_mtrand->randInt(m_max_allowed[i]));
+      m_current->set_occ(i, m_random_occ(m_max_allowed[i]));
     }
   }
 
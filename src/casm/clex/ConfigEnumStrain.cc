@@ -1,9 +1,11 @@
 #include "casm/clex/ConfigEnumStrain.hh"
 #include <algorithm>
+#include "casm/app/casm_functions.hh"
 #include "casm/clex/PrimClex.hh"
 #include "casm/clex/Supercell.hh"
-#include "casm/clex/ConfigEnumStrain.hh"
-#include "casm/clex/PrimClex.hh"
+#include "casm/clex/ConfigSelection.hh"
+#include "casm/clex/FilteredConfigIterator.hh"
+#include "casm/container/Enumerator_impl.hh"
 #include "casm/misc/CASM_math.hh"
 #include "casm/misc/algorithm.hh"
 
@@ -20,21 +22,162 @@ namespace CASM {
   const std::string ConfigEnumStrain::interface_help =
     "ConfigEnumStrain: \n\n"
 
-    "  ... include help documentation here ... \n\n";
+    "  configs: string or JSON array (default=\"MASTER\")\n"
+    "    Indicate the configurations to strain. May be a JSON array of           \n"
+    "    configuration names, or a string specifying a configuration selection   \n"
+    "    file name. By default, the selected configurations in the master list.  \n\n"
+
+    "  magnitudes: JSON array of numbers\n"
+    "    The maximum strain magnitude along each irreducible subspace of strain  \n"
+    "    space. One value is required for each subspace.                          \n\n"
+
+    "  subgrids: JSON array of integers (optional if 'sobol_samples' > 0)\n"
+    "    The number of grid points along each irreducible subspace of strain     \n"
+    "    space. Subspaces with fewer than 2 points are not strained. If          \n"
+    "    'sobol_samples' > 0 the default is 2 for each subspace.                  \n\n"
+
+    "  sobol_samples: integer (default=0)\n"
+    "    If > 0, instead of the grid use this many points of a Sobol sequence    \n"
+    "    in each irreducible wedge, keeping those within the strain ellipsoid.   \n\n"
+
+    "  strain_metric: string (default=\"GL\")\n"
+    "    The strain metric, one of \"GL\", \"EA\", \"B\", \"H\".                  \n\n"
+
+    "  primitive_only: bool (default=true)\n"
+    "    If true, only the primitive form of a configuration is saved in the      \n"
+    "    configuration list. Otherwise, both primitive and non-primitive          \n"
+    "    configurations are saved. \n\n"
+
+    "  filter: string (optional, default=None)\n"
+    "    A query command to use to filter which Configurations are kept.          \n\n"
+
+    "  Examples:\n"
+    "    To strain the selected configurations on a grid, for a prim with two    \n"
+    "    irreducible subspaces of strain space:\n"
+    "      casm enum --method ConfigEnumStrain -i \n"
+    "        '{\"magnitudes\": [0.02, 0.01], \"subgrids\": [5, 3]}' \n"
+    "\n"
+    "    To strain particular configurations at 50 Sobol points per wedge:\n"
+    "      casm enum --method ConfigEnumStrain -i \n"
+    "        '{\"configs\": [\"SCEL1_1_1_1_0_0_0/0\"], \n"
+    "          \"magnitudes\": [0.02, 0.01], \"sobol_samples\": 50}' \n\n";
 
   int ConfigEnumStrain::run(
     PrimClex &primclex,
     const jsonParser &_kwargs,
     const Completer::EnumOption &enum_opt) {
-    throw std::runtime_error("EnumInterface<Strain>::run is not implemented");
+
+    std::vector<std::string> filter_expr = make_enumerator_filter_expr(_kwargs, enum_opt);
+
+    if(!_kwargs.contains("magnitudes")) {
+      throw std::invalid_argument(
+        "Error in ConfigEnumStrain JSON input: 'magnitudes' is required");
+    }
+    std::vector<double> magnitudes;
+    from_json(magnitudes, _kwargs["magnitudes"]);
+
+    Index sobol_samples;
+    _kwargs.get_else<Index>(sobol_samples, "sobol_samples", 0);
+
+    std::vector<Index> subgrids;
+    if(_kwargs.contains("subgrids")) {
+      from_json(subgrids, _kwargs["subgrids"]);
+    }
+    else if(sobol_samples > 0) {
+      subgrids = std::vector<Index>(magnitudes.size(), 2);
+    }
+    else {
+      throw std::invalid_argument(
+        "Error in ConfigEnumStrain JSON input: 'subgrids' is required if 'sobol_samples' is 0");
+    }
+
+    std::string strain_mode;
+    _kwargs.get_else<std::string>(strain_mode, "strain_metric", "GL");
+
+    bool primitive_only = true;
+    _kwargs.get_if(primitive_only, "primitive_only");
+
+    // copy the initial configurations, which are not modified by inserting new configurations
+    std::vector<Configuration> init;
+    if(_kwargs.contains("configs") && _kwargs["configs"].is_array()) {
+      const jsonParser &j = _kwargs["configs"];
+      for(auto it = j.begin(); it != j.end(); ++it) {
+        init.push_back(primclex.configuration(it->get<std::string>()));
+      }
+    }
+    else {
+      fs::path selection_path("MASTER");
+      _kwargs.get_if(selection_path, "configs");
+      ConstConfigSelection selection(primclex, selection_path);
+      for(auto it = selection.selected_config_begin(); it != selection.selected_config_end(); ++it) {
+        init.push_back(*it);
+      }
+    }
+
+    Log &log = primclex.log();
+
+    Index Ninit = std::distance(primclex.config_begin(), primclex.config_end());
+    log << "# configurations in this project: " << Ninit << "\n" << std::endl;
+
+    log.begin(enumerator_name);
+
+    for(Configuration &config : init) {
+      log << "Enumerate strained configurations of " << config.name() << " ...  " << std::flush;
+
+      Supercell &scel = config.get_supercell();
+      ConfigEnumStrain enumerator(scel, config, subgrids, magnitudes, strain_mode, sobol_samples);
+      Index num_before = std::distance(primclex.config_begin(), primclex.config_end());
+      if(!filter_expr.empty()) {
+        try {
+          auto it = filter_begin(
+                      enumerator.begin(),
+                      enumerator.end(),
+                      filter_expr,
+                      primclex.settings().query_handler<Configuration>().dict());
+          auto end = filter_end(enumerator.end());
+          for(; it != end; ++it) {
+            it->insert(primitive_only);
+          }
+        }
+        catch(std::exception &e) {
+          primclex.err_log() << "Cannot filter configurations using the expression provided: \n" << e.what() << "\nExiting...\n";
+          return ERR_INVALID_ARG;
+        }
+      }
+      else {
+        for(auto it = enumerator.begin(); it != enumerator.end(); ++it) {
+          it->insert(primitive_only);
+        }
+      }
+
+      log << (std::distance(primclex.config_begin(), primclex.config_end()) - num_before) << " configs." << std::endl;
+    }
+    log << "  DONE." << std::endl << std::endl;
+
+    Index Nfinal = std::distance(primclex.config_begin(), primclex.config_end());
+
+    log << "# new configurations: " << Nfinal - Ninit << "\n";
+    log << "# configurations in this project: " << Nfinal << "\n" << std::endl;
+
+    log << "Write SCEL..." << std::endl;
+    primclex.print_supercells();
+    log << "  DONE" << std::endl << std::endl;
+
+    log << "Writing config_list..." << std::endl;
+    primclex.write_config_list();
+    log << "  DONE" << std::endl;
+
+    return 0;
   }
 
   ConfigEnumStrain::ConfigEnumStrain(Supercell &_scel,
                                      const Configuration &_init,
                                      const std::vector<Index> &linear_partitions,
                                      const std::vector<double> &magnitudes,
-                                     std::string _mode) :
+                                     std::string _mode,
+                                     Index sobol_samples) :
     m_current(_init),
+    m_sobol_samples(sobol_samples),
     m_equiv_ind(0),
     m_strain_calc(_mode),
     m_perm_begin(_scel.permute_begin()),
@@ -56,21 +199,20 @@ namespace CASM {
     //Eigen::MatrixXd axes=m_strain_calc.sop_transf_mat();
     std::vector<Index> mult;
     std::vector<Eigen::MatrixXd> wedges = m_strain_calc.irreducible_wedges(_scel.get_primclex().get_prim().point_group(), mult);
-    Eigen::VectorXd init(sdim), final(sdim), inc(sdim);
+    Eigen::VectorXd init(sdim), final(sdim), inc(sdim), upper(sdim);
     Index num_sub = wedges.size();
+    if(linear_partitions.size() < num_sub || absmags.size() < num_sub) {
+      throw std::invalid_argument(
+        "Error in ConfigEnumStrain: strain space has " + std::to_string(num_sub) +
+        " irreducible subspaces, and a subgrid and a magnitude are required for each");
+    }
 
     Index nc = 0;
     for(Index s = 0; s < num_sub; s++) {
       double wedgevol = sqrt((wedges[s].transpose() * wedges[s]).determinant());
       Index N = round(pow(linear_partitions[s], wedges[s].cols()));
       //double density = double(N) / pow(magnitudes[s], wedges[s].cols());
-      std::cout << "wedgevol: " << wedgevol << ", N: " << N;// << ", density: " << density;
       N = max(1, (int) ceil(pow(wedgevol * double(N), 1.0 / double(wedges[s].cols())) - TOL));
-      std::cout << ", linearN: " << N << "\n";
-      std::cout << "mult.size() is: " << mult.size() << "  and mult is ";
-      for(auto m : mult)
-        std::cout  << m << "  ";
-      std::cout << "\n";
 
       for(Index i = 0; i < wedges[s].cols(); i++, nc++) {
         if(mult[nc] == 1 && linear_partitions[s] > 1) {
@@ -88,10 +230,12 @@ namespace CASM {
         if(linear_partitions[s] < 2) {
           final(nc) = init(nc);
           inc(nc) = 10 * TOL;
+          upper(nc) = init(nc);
         }
         else {
           final(nc) = absmags[s] + TOL;
           inc(nc) = absmags[s] / double(N);
+          upper(nc) = absmags[s];
         }
       }
     }
@@ -148,63 +292,100 @@ namespace CASM {
 
 
     m_counter = EigenCounter<Eigen::VectorXd>(init, final, inc);
+    m_lower = init;
+    m_range = upper - init;
+    if(m_sobol_samples > 0) {
+      m_sobol = SobolSequence(sdim);
+    }
 
-    std::cout << "Project matrices are \n";
-    for(Index i = 0; i < m_trans_mats.size(); i++)
-      std::cout << i << " of " << m_trans_mats.size() << "\n" << m_trans_mats[i] << "\n\n";
-    m_shape_factor = m_strain_calc.sop_transf_mat().transpose() * m_shape_factor * m_strain_calc.sop_transf_mat();
+    // the wedges are in the coordinates of the unrolled strain, E, and the irreducible subspaces
+    // are in the coordinates sop_transf_mat().transpose() * E
+    m_shape_factor = m_strain_calc.sop_transf_mat() * m_shape_factor * m_strain_calc.sop_transf_mat().transpose();
 
-    m_counter.reset();
-    while(m_counter.valid() && double(m_counter().transpose()*m_trans_mats[m_equiv_ind].transpose()*m_shape_factor * m_trans_mats[m_equiv_ind]*m_counter()) > 1.0 + TOL) {
-      ++m_counter;
+    // the quadratic form for each transformation matrix is constant, so only calculate it once
+    for(const auto &trans_mat : m_trans_mats) {
+      m_shape_mats.push_back(trans_mat.transpose() * m_shape_factor * trans_mat);
     }
 
     reset_properties(m_current);
     this->_initialize(&m_current);
 
-    if(!m_counter.valid()) {
+    _first_point();
+    if(_find_valid()) {
+      _current().set_deformation(m_strain_calc.unrolled_strain_metric_to_F(m_trans_mats[m_equiv_ind] * m_point));
+    }
+    else {
       this->_invalidate();
     }
     _current().set_source(this->source(step()));
   }
 
-  // Implements _increment
-  void ConfigEnumStrain::increment() {
-    //bool is_valid_config(false);
-    //std::cout << "Incrementing...\n";
+  void ConfigEnumStrain::_first_point() {
+    if(m_sobol_samples > 0) {
+      m_sobol.reset();
+      m_point = m_lower + m_range.cwiseProduct(m_sobol.next());
+    }
+    else {
+      m_counter.reset();
+      m_point = m_counter();
+    }
+  }
 
-    while(++m_counter && double(m_counter().transpose()*m_trans_mats[m_equiv_ind].transpose()*m_shape_factor * m_trans_mats[m_equiv_ind]*m_counter()) > 1.0 + TOL) {
-      //just burning throught the count
+  bool ConfigEnumStrain::_next_point() {
+    if(m_sobol_samples > 0) {
+      if(m_sobol.index() >= m_sobol_samples) {
+        return false;
+      }
+      m_point = m_lower + m_range.cwiseProduct(m_sobol.next());
+      return true;
     }
+    if(!(++m_counter)) {
+      return false;
+    }
+    m_point = m_counter();
+    return true;
+  }
 
-    // move to next part of wedge if necessary
-    if(!m_counter.valid() && m_equiv_ind + 1 < m_trans_mats.size()) {
-      m_counter.reset();
-      ++m_equiv_ind;
-      std::cout << "INCREMENTING m_equiv_ind to " << m_equiv_ind << "\n";
+  bool ConfigEnumStrain::_in_range() const {
+    return double(m_point.dot(m_shape_mats[m_equiv_ind] * m_point)) <= 1.0 + TOL;
+  }
+
+  bool ConfigEnumStrain::_find_valid() {
+    if(m_trans_mats.empty()) {
+      return false;
+    }
+    while(!_in_range()) {
+      if(!_next_point()) {
+        // move to next part of wedge if necessary
+        if(m_equiv_ind + 1 >= m_trans_mats.size()) {
+          return false;
+        }
+        ++m_equiv_ind;
+        _first_point();
+      }
     }
+    return true;
+  }
 
-    while(m_counter && double(m_counter().transpose()*m_trans_mats[m_equiv_ind].transpose()*m_shape_factor * m_trans_mats[m_equiv_ind]*m_counter()) > 1.0 + TOL) {
-      //just burning throught the count
-      ++m_counter;
+  // Implements _increment
+  void ConfigEnumStrain::increment() {
+
+    bool valid = _next_point();
+    if(!valid && m_equiv_ind + 1 < m_trans_mats.size()) {
+      // move to next part of wedge
+      ++m_equiv_ind;
+      _first_point();
+      valid = true;
     }
 
-    if(m_counter.valid()) {
-      _current().set_deformation(m_strain_calc.unrolled_strain_metric_to_F(m_trans_mats[m_equiv_ind] * m_counter()));
-      std::cout << "Counter is " << m_counter().transpose() << "\n\n";
-      //std::cout << "strain vector is \n" << m_trans_mats[m_equiv_ind]*m_counter() << "\n\n";
-      //std::cout << "DEFORMATION IS\n" << _current().deformation() << "\n\n";
-      //is_valid_config = current().is_canonical(_perm_begin(), _perm_end());
-      //std::cout << "counter() is: " << m_counter() << ";  is_valid_config: " << is_valid_config
-      //<< ";  is_valid_counter: " << m_counter.valid() << "\n";
+    if(valid && _find_valid()) {
+      _current().set_deformation(m_strain_calc.unrolled_strain_metric_to_F(m_trans_mats[m_equiv_ind] * m_point));
       _increment_step();
     }
     else {
-      //std::cout << "REACHED END OF THE LINE!\n";
       _invalidate();
     }
     _current().set_source(this->source(step()));
-    //std::cout << "--FINISHED SEARCH " << _step()<< "--\n";
     return;
   }
 
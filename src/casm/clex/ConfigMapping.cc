@@ -1,3 +1,7 @@
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include "casm/clex/PrimClex.hh"
 #include "casm/clex/ConfigMapping.hh"
 #include "casm/strain/StrainConverter.hh"
@@ -5,6 +9,7 @@
 #include "casm/crystallography/Niggli.hh"
 #include "casm/crystallography/LatticeMap.hh"
 #include "casm/crystallography/SupercellEnumerator.hh"
+#include "casm/casm_io/SafeOfstream.hh"
 
 namespace CASM {
   namespace ConfigMapping {
@@ -101,7 +106,9 @@ namespace CASM {
     m_robust_flag(options & robust),
     m_strict_flag(options & strict),
     m_rotate_flag(options & rotate),
-    m_tol(max(1e-9, _tol)) {
+    m_tol(max(1e-9, _tol)),
+    m_max_threads(max(Index(std::thread::hardware_concurrency()), Index(1))),
+    m_lattice_cache_loaded(false) {
     //squeeze lattice_weight into (0,1] if necessary
     m_lattice_weight = max(min(_lattice_weight, 1.0), 1e-9);
     ParamComposition param_comp(_pclex.get_prim());
@@ -109,6 +116,29 @@ namespace CASM {
     m_max_volume_change = max(m_tol, _max_volume_change);
   }
 
+  //*******************************************************************************************
+  struct ConfigMapper::SharedBound {
+
+    SharedBound(double _value) :
+      value(_value) {}
+
+    /// \brief Lower the bound to 'cost', if 'cost' is less
+    void update(double cost) {
+      double curr = value;
+      while(cost < curr && !value.compare_exchange_weak(curr, cost)) {}
+    }
+
+    std::atomic<double> value;
+  };
+
+  //*******************************************************************************************
+  struct ConfigMapper::LatticeMapping {
+    double cost;
+    ConfigDoF configdof;
+    std::vector<Index> assignment;
+    Eigen::Matrix3d cart_op;
+  };
+
   //*******************************************************************************************
 
   bool ConfigMapper::import_structure_occupation(const fs::path &pos_path,
@@ -486,6 +516,8 @@ namespace CASM {
     double lw = m_lattice_weight;
     double bw = 1.0 - lw;
 
+    // Only mappings that cost less than this may be chosen
+    double max_cost = best_cost;
 
     std::vector<Index> assignment;
     //Add new Supercell if it doesn't exist already. Use primitive point group to check for equivalence and
@@ -593,19 +625,90 @@ namespace CASM {
 
 
     //Second pass: Find the absolute best mapping
+    // - Candidate lattices are mapped in parallel, sharing the cost of the best mapping found so far
+    //   to skip mappings that cannot be chosen
+    // - Mappings within m_tol of the best are considered equivalent, and the first of them in serial
+    //   order (the first pass result, then candidates by volume, then mappings in the order they are
+    //   enumerated) is chosen, so the result does not depend on the number of threads
+    if(mapped_configdof.size() > 0) {
+      best_cost += m_tol;
+    }
+    SharedBound bound(best_cost);
+
+    std::vector<std::pair<Index, const Lattice *> > candidates;
     for(Index i_vol = min_vol; i_vol <= max_vol; i_vol++) {
-      //std::cout << "  vol = " << i_vol << "\n";
-      const std::vector<Lattice> &lat_vec = _lattices_of_vol(i_vol);
-
-      for(auto it = lat_vec.cbegin(); it != lat_vec.cend(); ++it) {
-        if(!deformed_struc_to_configdof_of_lattice(struc,
-                                                   *it,
-                                                   best_cost,
-                                                   mapped_configdof,
-                                                   mapped_lat,
-                                                   best_assignment,
-                                                   cart_op))
-          break;
+      for(const Lattice &lat : _lattices_of_vol(i_vol)) {
+        candidates.push_back(std::make_pair(i_vol, &lat));
+      }
+    }
+
+    // Lattice generates its voronoi table on first use, so do that before sharing
+    primclex().get_prim().lattice().voronoi_table();
+    struc.lattice().voronoi_table();
+
+    std::vector<std::vector<LatticeMapping> > mappings(candidates.size());
+    std::vector<std::atomic<bool> > incompatible(max_vol - min_vol + 1);
+    for(auto &flag : incompatible) {
+      flag = false;
+    }
+
+    Index n_candidates = candidates.size();
+    std::atomic<Index> next(0);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto work = [&]() {
+      try {
+        for(Index i = next++; i < n_candidates; i = next++) {
+          // mapping onto one lattice of a volume fails only if all of them do
+          std::atomic<bool> &vol_incompatible = incompatible[candidates[i].first - min_vol];
+          if(vol_incompatible) {
+            continue;
+          }
+          Lattice imposed_lat(*candidates[i].second);
+          if(!_lattice_mappings(struc, imposed_lat, bound, mappings[i])) {
+            mappings[i].clear();
+            vol_incompatible = true;
+          }
+        }
+      }
+      catch(...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if(!error) {
+          error = std::current_exception();
+        }
+        next = n_candidates;
+      }
+    };
+
+    Index n_threads = min(max_threads(), n_candidates);
+    std::vector<std::thread> threads;
+    for(Index i = 1; i < n_threads; i++) {
+      threads.emplace_back(work);
+    }
+    work();
+    for(auto &thread : threads) {
+      thread.join();
+    }
+    if(error) {
+      std::rethrow_exception(error);
+    }
+
+    // keep the first pass result if it is within m_tol of the best, else choose the first mapping that is
+    if(mapped_configdof.size() == 0 || best_cost >= bound.value + m_tol) {
+      double choose_below = min(bound.value + m_tol, max_cost);
+      bool found = false;
+      for(Index i = 0; i < n_candidates && !found; i++) {
+        for(LatticeMapping &mapping : mappings[i]) {
+          if(mapping.cost < choose_below) {
+            best_cost = mapping.cost;
+            swap(mapped_configdof, mapping.configdof);
+            swap(best_assignment, mapping.assignment);
+            cart_op = mapping.cart_op;
+            mapped_lat = *candidates[i].second;
+            found = true;
+            break;
+          }
+        }
       }
     }
 
@@ -628,33 +731,70 @@ namespace CASM {
                                                             Lattice &mapped_lat,
                                                             std::vector<Index> &best_assignment,
                                                             Eigen::Matrix3d &cart_op) const {
+    SharedBound bound(best_cost);
+    std::vector<LatticeMapping> mappings;
+    if(!_lattice_mappings(struc, imposed_lat, bound, mappings)) {
+      return false;
+    }
+
+    // choose the first mapping within m_tol of the best
+    double choose_below = min(bound.value + m_tol, best_cost);
+    for(auto &mapping : mappings) {
+      if(mapping.cost < choose_below) {
+        best_cost = mapping.cost - m_tol;
+        swap(mapped_configdof, mapping.configdof);
+        swap(best_assignment, mapping.assignment);
+        cart_op = mapping.cart_op;
+        mapped_lat = imposed_lat;
+        break;
+      }
+    }
+    return true;
+  }
+
+  //*******************************************************************************************
+  bool ConfigMapper::_lattice_mappings(const BasicStructure<Site> &struc,
+                                       const Lattice &imposed_lat,
+                                       SharedBound &bound,
+                                       std::vector<LatticeMapping> &mappings) const {
     double strain_cost, basis_cost, tot_cost;
     ConfigDoF tdof;
-    BasicStructure<Site> tstruc(struc);
+    BasicStructure<Site> tstruc;
     Eigen::Matrix3d tF, rotF;
     std::vector<Index> assignment;
-    Supercell scel(&primclex(), imposed_lat);
+
+    // Most candidate lattices are rejected by strain cost alone, so only construct the
+    // Supercell once a basis mapping is needed
+    std::unique_ptr<Supercell> scel;
+    auto get_scel = [&]() -> const Supercell & {
+      if(!scel) {
+        scel.reset(new Supercell(&primclex(), imposed_lat));
+      }
+      return *scel;
+    };
+
+    // Only mappings that cost less than this may be chosen
+    auto max_cost = [&]() -> double {
+      double result = bound.value + m_tol;
+      if(mappings.size()) {
+        result = min(result, mappings.back().cost);
+      }
+      return result;
+    };
 
     double lw = m_lattice_weight;
     double bw = 1.0 - lw;
     double num_atoms = double(struc.basis.size());
-    //Determine best mapping for this supercell
-
-    //Initialize with simplest mapping onto supercell 'i', so that we don't change the crystal setting unnecessarily
-    tF = struc.lattice().lat_column_mat() * imposed_lat.inv_lat_column_mat();
 
-    strain_cost = lw * LatticeMap::calc_strain_cost(tF, struc.lattice().vol() / max(num_atoms, 1.));
-
-    // If simplest mapping seems viable, check it further
-    if(strain_cost < best_cost) {
-      tstruc = struc;
-      tstruc.set_lattice(imposed_lat, FRAC);
+    // Map the basis of tstruc, given the deformation tF, and record it if it may be chosen
+    // Returns false if tstruc is incompatible with imposed_lat
+    auto map_basis = [&]() -> bool {
       rotF = tF;
       if(m_rotate_flag) {
         rotF = StrainConverter::right_stretch_tensor(tF);
       }
 
-      if(!ConfigMap_impl::preconditioned_struc_to_configdof(scel,
+      if(!ConfigMap_impl::preconditioned_struc_to_configdof(get_scel(),
                                                             tstruc,
                                                             rotF,
                                                             tdof,
@@ -664,31 +804,41 @@ namespace CASM {
         return false;
 
       basis_cost = bw * ConfigMapping::basis_cost(tdof, struc.basis.size());
-      //std::cout << "\n**Starting strain_cost = " << strain_cost << ";   and basis_cost = " << basis_cost << "  TOTAL: " << strain_cost + basis_cost << "\n";
       tot_cost = strain_cost + basis_cost;
 
-      //std::cout << "    scel.name = " << scel.get_name()  << "  simple map: strain_cost " << strain_cost << "   best_cost " << best_cost << "    tot_cost " << tot_cost << "\n";
-      if(tot_cost < best_cost) {
-        best_cost = tot_cost - m_tol;
-        //best_strain_cost = strain_cost;
-        //best_basis_cost = basis_cost;
-        swap(best_assignment, assignment);
-        cart_op = rotF * tF.inverse();
-        //best_trans = Matrix3<double>::identity();
-        //std::cout << "tF is:\n" << tF << "\n and N is:\n" << best_trans << "\n";
-        swap(mapped_configdof, tdof);
-        mapped_lat = imposed_lat;
+      if(tot_cost < max_cost()) {
+        mappings.push_back(LatticeMapping());
+        LatticeMapping &mapping = mappings.back();
+        mapping.cost = tot_cost;
+        swap(mapping.configdof, tdof);
+        swap(mapping.assignment, assignment);
+        mapping.cart_op = rotF * tF.inverse();
+        bound.update(tot_cost);
       }
+      return true;
+    };
+
+    //Initialize with simplest mapping onto imposed_lat, so that we don't change the crystal setting unnecessarily
+    tF = struc.lattice().lat_column_mat() * imposed_lat.inv_lat_column_mat();
+
+    strain_cost = lw * LatticeMap::calc_strain_cost(tF, struc.lattice().vol() / max(num_atoms, 1.));
+
+    // If simplest mapping seems viable, check it further
+    if(strain_cost < max_cost()) {
+      tstruc = struc;
+      tstruc.set_lattice(imposed_lat, FRAC);
+      if(!map_basis())
+        return false;
     } // Done checking simplest mapping
 
     // If the simplest mapping is best, we have avoided a lot of extra work, but we still need to check for
     // non-trivial mappings that are better than both the simplest mapping and the best found mapping
     LatticeMap strainmap(imposed_lat, struc.lattice(), round(num_atoms), m_tol, 1);
     strain_cost = lw * strainmap.strain_cost();
-    if(best_cost < strain_cost)
-      strain_cost = lw * strainmap.next_mapping_better_than(best_cost).strain_cost();
+    if(max_cost() < strain_cost)
+      strain_cost = lw * strainmap.next_mapping_better_than(max_cost()).strain_cost();
 
-    while(strain_cost < best_cost) {  // only enter loop if there's a chance of improving on current best
+    while(strain_cost < max_cost()) {  // only enter loop if there's a chance of improving on current best
 
       tstruc = struc;
       // We modify the deformed structure so that its lattice is a deformed version of the nearest ideal lattice
@@ -696,54 +846,62 @@ namespace CASM {
       tstruc.set_lattice(Lattice(imposed_lat.lat_column_mat()*strainmap.matrixN()), FRAC);
       tstruc.set_lattice(imposed_lat, CART);
       tF = strainmap.matrixF();
-      rotF = tF;
-      if(m_rotate_flag) {
-        rotF = StrainConverter::right_stretch_tensor(tF);
-      }
 
-      if(!ConfigMap_impl::preconditioned_struc_to_configdof(scel,
-                                                            tstruc,
-                                                            rotF,
-                                                            tdof,
-                                                            assignment,
-                                                            true,
-                                                            m_tol)) {
+      if(!map_basis())
         return false;
-        //no longer unexpected
-        //throw std::runtime_error("Unexpected error in deformed_struc_to_config_dof(). This should never happen!\n");
-      }
-      basis_cost = bw * ConfigMapping::basis_cost(tdof, struc.basis.size());
-      //std::cout << "New strain_cost = " << strain_cost << ";   and basis_cost = " << basis_cost << "  TOTAL: " << strain_cost + basis_cost << "\n";
-      //std::cout << "  Compare -> best_cost = " << best_cost << "\n";
-
-      tot_cost = strain_cost + basis_cost;
-      //std::cout << "      complex map: best_cost " << best_cost << "    strain_cost " << strain_cost << "    tot_cost " << tot_cost << "\n";
 
-      if(tot_cost < best_cost) {
-        //std::cout << "Old best_trans, with cost " << best_cost << ":\n" << best_trans << "\n";
-        best_cost = tot_cost - m_tol;
-        swap(best_assignment, assignment);
-        //best_strain_cost = strain_cost;
-        //best_basis_cost = basis_cost;
-        cart_op = rotF * tF.inverse();
-        //best_trans = strainmap.matrixN();
-        //std::cout << "New best_trans, with cost " << best_cost << ":\n" << best_trans << "\n";
-        swap(mapped_configdof, tdof);
-        mapped_lat = imposed_lat;
-      }
       // This finds first decomposition:
       //            struc.lattice() =  deformation*(supercell_list[import_scel_index].get_real_super_lattice())*equiv_mat
-      //   that has cost function less than best_cost
-      strain_cost = lw * strainmap.next_mapping_better_than(best_cost).strain_cost();
+      //   that has cost function less than max_cost()
+      strain_cost = lw * strainmap.next_mapping_better_than(max_cost()).strain_cost();
     }
     return true;
   }
 
   //*******************************************************************************************
+  namespace {
+
+    /// \brief Data identifying the lattices stored in the lattice enumeration cache
+    jsonParser _lattice_cache_key(const Structure &prim, double tol) {
+      jsonParser key;
+      to_json(prim.lattice().lat_column_mat(), key["lattice"]);
+      key["point_group"].put_array();
+      const Eigen::Matrix3d &lat = prim.lattice().lat_column_mat();
+      for(Index i = 0; i < prim.point_group().size(); i++) {
+        Eigen::Matrix3i op = iround(lat.inverse() * prim.point_group()[i].matrix() * lat);
+        key["point_group"].push_back(jsonParser());
+        to_json(op, key["point_group"][i]);
+      }
+      key["tol"] = tol;
+      return key;
+    }
+
+    /// \brief Check if a lattice enumeration cache was written with the same key
+    bool _lattice_cache_matches(const jsonParser &cache, const jsonParser &key) {
+      if(!cache.contains("key") || !cache.contains("volumes")) {
+        return false;
+      }
+      const jsonParser &cache_key = cache["key"];
+      Eigen::Matrix3d lat, cache_lat;
+      from_json(lat, key["lattice"]);
+      from_json(cache_lat, cache_key["lattice"]);
+      return almost_equal(lat, cache_lat, 1e-8) &&
+             cache_key["point_group"] == key["point_group"] &&
+             almost_equal(cache_key["tol"].get<double>(), key["tol"].get<double>(), 1e-12);
+    }
+  }
+
+  /// Lattices are enumerated by SupercellEnumerator and stored both in memory and, if the
+  /// PrimClex has a project directory, in the lattice enumeration cache. The cache holds the
+  /// transformation matrices of the lattices for each volume, is read once per ConfigMapper,
+  /// and is reset if the prim lattice, point group, or tolerance changes.
   const std::vector<Lattice> &ConfigMapper::_lattices_of_vol(Index prim_vol) const {
     if(!valid_index(prim_vol)) {
       throw std::runtime_error("Cannot enumerate lattice of volume " + std::to_string(prim_vol) + ", which is out of bounds.\n");
     }
+    if(!m_lattice_cache_loaded) {
+      _read_lattice_cache();
+    }
     auto it = m_superlat_map.find(prim_vol);
     if(it != m_superlat_map.end())
       return it->second;
@@ -759,9 +917,86 @@ namespace CASM {
       //std::cout << "Enumeration step " << l++ << " best cost is " << best_cost << "\n";
       lat_vec.push_back(canonical_equivalent_lattice(*it, primclex().get_prim().point_group(), m_tol));
     }
+    m_superlat_map[prim_vol] = std::move(lat_vec);
+
+    _write_lattice_cache();
+
+    return m_superlat_map[prim_vol];
+
+  }
+
+  //*******************************************************************************************
+  /// If the cache can not be read, or does not match the prim and tolerance, it is ignored
+  /// and the lattices are enumerated as needed.
+  void ConfigMapper::_read_lattice_cache() const {
+    m_lattice_cache_loaded = true;
+    if(primclex().get_path().empty()) {
+      return;
+    }
+    fs::path cache_path = primclex().dir().lattice_enum_cache();
+    if(!fs::exists(cache_path)) {
+      return;
+    }
 
-    return m_superlat_map[prim_vol] = std::move(lat_vec);
+    const Lattice &prim_lat = primclex().get_prim().lattice();
+    std::map<Index, std::vector<Lattice> > cached;
+    try {
+      jsonParser cache(cache_path);
+      if(!_lattice_cache_matches(cache, _lattice_cache_key(primclex().get_prim(), m_tol))) {
+        return;
+      }
+      for(auto vol_it = cache["volumes"].begin(); vol_it != cache["volumes"].end(); ++vol_it) {
+        Index vol = std::stol(vol_it.name());
+        std::vector<Lattice> &lat_vec = cached[vol];
+        for(auto mat_it = vol_it->begin(); mat_it != vol_it->end(); ++mat_it) {
+          Eigen::Matrix3i T;
+          from_json(T, *mat_it);
+          if(std::abs(T.determinant()) != vol) {
+            return;
+          }
+          lat_vec.push_back(make_supercell(prim_lat, T));
+        }
+      }
+    }
+    catch(std::exception &e) {
+      return;
+    }
+    m_superlat_map.insert(cached.begin(), cached.end());
+  }
 
+  //*******************************************************************************************
+  /// Failure to write the cache is not an error; the lattices are enumerated again next time.
+  void ConfigMapper::_write_lattice_cache() const {
+    if(primclex().get_path().empty()) {
+      return;
+    }
+    fs::path cache_path = primclex().dir().lattice_enum_cache();
+
+    const Lattice &prim_lat = primclex().get_prim().lattice();
+    jsonParser cache;
+    cache["key"] = _lattice_cache_key(primclex().get_prim(), m_tol);
+    cache["volumes"] = jsonParser::object();
+    for(const auto &value : m_superlat_map) {
+      jsonParser &mats = cache["volumes"][std::to_string(value.first)].put_array();
+      for(const Lattice &lat : value.second) {
+        Eigen::Matrix3i T = iround(prim_lat.inv_lat_column_mat() * lat.lat_column_mat());
+        mats.push_back(jsonParser());
+        to_json(T, mats[mats.size() - 1]);
+      }
+    }
+
+    try {
+      SafeOfstream outfile;
+      outfile.open(cache_path);
+      cache.print(outfile.ofstream());
+      outfile.close();
+      if(outfile.ofstream().fail()) {
+        fs::remove(cache_path.string() + ".tmp");
+      }
+    }
+    catch(std::exception &e) {
+      return;
+    }
   }
 
   //****************************************************************************************************************
@@ -1014,18 +1249,22 @@ namespace CASM {
           return false;
         }
 
-        // The mapping routine is called here
-        mean = hungarian_method(cost_matrix, optimal_assignments, _tol);
+        // add small penalty (~_tol) for larger translation distances, so that shortest equivalent translation is used
+        double penalty = _tol * translation.const_cart().norm() / 10.0;
+
+        // The mapping routine is called here. It stops early if this translation can't improve on min_mean
+        mean = hungarian_method(cost_matrix, optimal_assignments, _tol, min_mean - penalty);
 
         // if optimal_assignments is smaller than rstruc.basis.size(), then rstruc is incompattible with supercell
         // (optimal_assignments.size()==0 if the hungarian routine detects an incompatibility)
         if(optimal_assignments.size() < rstruc.basis.size()) {
+          if(mean < 1e20 && mean > min_mean - penalty) {
+            continue;
+          }
           return false;
         }
 
-
-        // add small penalty (~_tol) for larger translation distances, so that shortest equivalent translation is used
-        mean += _tol * translation.const_cart().norm() / 10.0;
+        mean += penalty;
 
         if(mean < min_mean) {
           //std::cout << "mean " << mean << " is better than min_mean " << min_mean <<"\n";
@@ -1193,18 +1432,23 @@ namespace CASM {
           return false;
         }
 
-        // The mapping routine is called here
-        mean = hungarian_method(cost_matrix, optimal_assignments, _tol);
+        // add small penalty (~_tol) for larger translation distances, so that shortest equivalent translation is used
+        double penalty = _tol * translation.const_cart().norm() / 10.0;
+
+        // The mapping routine is called here. It stops early if this translation can't improve on min_mean
+        mean = hungarian_method(cost_matrix, optimal_assignments, _tol, min_mean - penalty);
 
         // if optimal_assignments is smaller than rstruc.basis.size(), then rstruc is incompattible
         // with the supercell (optimal_assignments.size()==0 if the hungarian routine detects an incompatibility)
         if(optimal_assignments.size() < rstruc.basis.size()) {
+          if(mean < 1e20 && mean > min_mean - penalty) {
+            continue;
+          }
           return false;
         }
 
         //std::cout << "mean is " << mean << " and stddev is " << stddev << "\n";
-        // add small penalty (~_tol) for larger translation distances, so that shortest equivalent translation is used
-        mean += _tol * translation.const_cart().norm() / 10.0;
+        mean += penalty;
         if(mean < min_mean) {
           //std::cout << "mean " << mean << " is better than min_mean " << min_mean <<"\n";
 
@@ -0,0 +1,189 @@
+#include "casm/clex/DataClexulator.hh"
+
+#include "casm/casm_io/jsonParser.hh"
+#include "casm/casm_io/json_io/container.hh"
+
+namespace CASM {
+
+  namespace Clexulator_impl {
+
+    DataClexulator::DataClexulator(const jsonParser &json) :
+      Base(json["nlist_size"].get<size_type>(), json["corr_size"].get<size_type>()) {
+
+      from_json(m_weight_matrix, json["weight_matrix"]);
+
+      for(auto it = json["neighborhood"].begin(); it != json["neighborhood"].end(); ++it) {
+        m_neighborhood.insert(it->get<UnitCellCoord>());
+      }
+
+      std::vector<std::set<UnitCellCoord> > orbit_nbors(json["orbit_neighborhood"].size());
+      for(Index no = 0; no < orbit_nbors.size(); ++no) {
+        const jsonParser &sites = json["orbit_neighborhood"][no];
+        for(auto it = sites.begin(); it != sites.end(); ++it) {
+          orbit_nbors[no].insert(it->get<UnitCellCoord>());
+        }
+      }
+      m_orbit_neighborhood.reserve(corr_size());
+      for(auto it = json["orbit_index"].begin(); it != json["orbit_index"].end(); ++it) {
+        m_orbit_neighborhood.push_back(orbit_nbors[it->get<Index>()]);
+      }
+
+      const jsonParser &occ_func = json["occ_func"];
+      m_occ_func_begin.resize(occ_func.size());
+      for(Index b = 0; b < occ_func.size(); ++b) {
+        for(Index f = 0; f < occ_func[b].size(); ++f) {
+          m_occ_func_begin[b].push_back(m_occ_func.size());
+          for(Index s = 0; s < occ_func[b][f].size(); ++s) {
+            m_occ_func.push_back(occ_func[b][f][s].get<double>());
+          }
+        }
+      }
+
+      m_orbit_func = _read_table(json["orbit_functions"]);
+
+      const jsonParser &flower = json["flower_functions"];
+      m_flower_func.resize(flower.size());
+      m_flower_nlist_ind.resize(flower.size(), 0);
+      for(Index b = 0; b < flower.size(); ++b) {
+        if(flower[b].is_null()) {
+          continue;
+        }
+        m_flower_nlist_ind[b] = flower[b]["nlist_index"].get<size_type>();
+        m_flower_func[b] = _read_table(flower[b]);
+      }
+    }
+
+    //*******************************************************************************************
+
+    void DataClexulator::calc_global_corr_contribution(double *corr_begin) const {
+      for(size_type i = 0; i < corr_size(); i++) {
+        *(corr_begin + i) = _eval(m_orbit_func, i);
+      }
+    }
+
+    //*******************************************************************************************
+
+    void DataClexulator::calc_restricted_global_corr_contribution(double *corr_begin, size_type const *ind_list_begin, size_type const *ind_list_end) const {
+      for(; ind_list_begin < ind_list_end; ind_list_begin++) {
+        *(corr_begin + *ind_list_begin) = _eval(m_orbit_func, *ind_list_begin);
+      }
+    }
+
+    //*******************************************************************************************
+
+    void DataClexulator::calc_point_corr(int b_index, double *corr_begin) const {
+      for(size_type i = 0; i < corr_size(); i++) {
+        *(corr_begin + i) = _eval(m_flower_func[b_index], i);
+      }
+    }
+
+    //*******************************************************************************************
+
+    void DataClexulator::calc_restricted_point_corr(int b_index, double *corr_begin, size_type const *ind_list_begin, size_type const *ind_list_end) const {
+      for(; ind_list_begin < ind_list_end; ind_list_begin++) {
+        *(corr_begin + *ind_list_begin) = _eval(m_flower_func[b_index], *ind_list_begin);
+      }
+    }
+
+    //*******************************************************************************************
+
+    void DataClexulator::calc_delta_point_corr(int b_index, int occ_i, int occ_f, double *corr_begin) const {
+      for(size_type i = 0; i < corr_size(); i++) {
+        *(corr_begin + i) = _eval_delta(m_flower_func[b_index], i, m_flower_nlist_ind[b_index], occ_i, occ_f);
+      }
+    }
+
+    //*******************************************************************************************
+
+    void DataClexulator::calc_restricted_delta_point_corr(int b_index,
+                                                          int occ_i,
+                                                          int occ_f,
+                                                          double *corr_begin,
+                                                          size_type const *ind_list_begin,
+                                                          size_type const *ind_list_end) const {
+      for(; ind_list_begin < ind_list_end; ind_list_begin++) {
+        *(corr_begin + *ind_list_begin) = _eval_delta(m_flower_func[b_index], *ind_list_begin, m_flower_nlist_ind[b_index], occ_i, occ_f);
+      }
+    }
+
+    //*******************************************************************************************
+
+    DataClexulator::FunctionTable DataClexulator::_read_table(const jsonParser &json) const {
+      FunctionTable table;
+      from_json(table.function_begin, json["function_begin"]);
+      from_json(table.coeff, json["coeff"]);
+      from_json(table.term_begin, json["term_begin"]);
+      from_json(table.nlist_ind, json["nlist_index"]);
+
+      // convert (sublattice, function) pairs to indices into m_occ_func
+      std::vector<size_type> sublat, func;
+      from_json(sublat, json["sublat"]);
+      from_json(func, json["occ_func_index"]);
+      table.occ_func.resize(sublat.size());
+      for(Index k = 0; k < sublat.size(); ++k) {
+        table.occ_func[k] = m_occ_func_begin[sublat[k]][func[k]];
+      }
+
+      if(table.function_begin.size() != corr_size() + 1) {
+        throw std::runtime_error("Error reading Clexulator data: number of functions does not match 'corr_size'");
+      }
+      return table;
+    }
+
+    //*******************************************************************************************
+
+    double DataClexulator::_eval(const FunctionTable &table, size_type i) const {
+      if(!table.function_begin.size()) {
+        return 0.0;
+      }
+      double result = 0.0;
+      for(size_type t = table.function_begin[i]; t < table.function_begin[i + 1]; ++t) {
+        double term = table.coeff[t];
+        for(size_type k = table.term_begin[t]; k < table.term_begin[t + 1]; ++k) {
+          term *= m_occ_func[table.occ_func[k] + *(m_occ_ptr + *(m_nlist_ptr + table.nlist_ind[k]))];
+        }
+        result += term;
+      }
+      return result;
+    }
+
+    //*******************************************************************************************
+
+    double DataClexulator::_eval_delta(const FunctionTable &table, size_type i, size_type center, int occ_i, int occ_f) const {
+      if(!table.function_begin.size()) {
+        return 0.0;
+      }
+      double result = 0.0;
+      for(size_type t = table.function_begin[i]; t < table.function_begin[i + 1]; ++t) {
+        double term_i = table.coeff[t];
+        double term_f = table.coeff[t];
+        for(size_type k = table.term_begin[t]; k < table.term_begin[t + 1]; ++k) {
+          if(table.nlist_ind[k] == center) {
+            term_i *= m_occ_func[table.occ_func[k] + occ_i];
+            term_f *= m_occ_func[table.occ_func[k] + occ_f];
+          }
+          else {
+            double val = m_occ_func[table.occ_func[k] + *(m_occ_ptr + *(m_nlist_ptr + table.nlist_ind[k]))];
+            term_i *= val;
+            term_f *= val;
+          }
+        }
+        result += term_f - term_i;
+      }
+      return result;
+    }
+
+  }
+
+  //*******************************************************************************************
+
+  Clexulator::Clexulator(std::string name,
+                         const jsonParser &data,
+                         PrimNeighborList &nlist) :
+    m_name(name),
+    m_clex(new Clexulator_impl::DataClexulator(data)) {
+
+    _init_nlist(nlist);
+  }
+
+}
@@ -12,6 +12,8 @@
 #include "casm/crystallography/Coordinate.hh"
 #include "casm/app/AppIO.hh"
 #include "casm/crystallography/Niggli.hh"
+#include "casm/basis_set/PolynomialFunction.hh"
+#include "casm/basis_set/OccupantFunction.hh"
 
 namespace CASM {
   //*******************************************************************************************
@@ -67,6 +69,10 @@ namespace CASM {
       return;
     }
 
+    // use the symmetry group tables cached by 'casm sym', if they are for these groups
+    read_symgroup_tables(prim.factor_group(), m_dir.symgroup_tables("factor_group"));
+    read_symgroup_tables(prim.point_group(), m_dir.symgroup_tables("crystal_point_group"));
+
     bool read_settings = false;
     bool read_composition = true;
     bool read_chem_ref = true;
@@ -1018,7 +1024,8 @@ namespace CASM {
   bool PrimClex::has_clexulator(const ClexDescription &key) const {
     auto it = m_clexulator.find(key);
     if(it == m_clexulator.end()) {
-      if(!fs::exists(dir().clexulator_src(settings().name(), key.bset))) {
+      if(!fs::exists(dir().clexulator_src(settings().name(), key.bset)) &&
+         !fs::exists(dir().clexulator_data(settings().name(), key.bset))) {
         return false;
       }
     }
@@ -1032,6 +1039,16 @@ namespace CASM {
     auto it = m_clexulator.find(key);
     if(it == m_clexulator.end()) {
 
+      // basis function data does not need to be compiled
+      fs::path data_path = dir().clexulator_data(settings().name(), key.bset);
+      if(fs::exists(data_path)) {
+        it = m_clexulator.insert(
+               std::make_pair(key, Clexulator(settings().name() + "_Clexulator",
+                                              jsonParser(data_path),
+                                              nlist()))).first;
+        return it->second;
+      }
+
       if(!fs::exists(dir().clexulator_src(settings().name(), key.bset))) {
         throw std::runtime_error(
           std::string("Error loading clexulator ") + key.bset + ". No basis functions exist.");
@@ -1708,5 +1725,193 @@ namespace CASM {
     return;
   }
 
+  //*******************************************************************************************
+
+  namespace {
+
+    /// \brief A coefficient times a product of site basis functions
+    struct ClexulatorDataTerm {
+
+      double coeff;
+
+      /// (neighbor list index, sublattice, site basis function index) of each factor
+      std::vector<std::array<Index, 3> > factor;
+    };
+
+    typedef std::vector<std::vector<ClexulatorDataTerm> > ClexulatorDataFunctions;
+
+    /// \brief Append the terms of 'func', scaled by 'scale', to 'terms'
+    void _add_data_terms(const Function *func, double scale, std::vector<ClexulatorDataTerm> &terms) {
+
+      const PolynomialFunction *poly = dynamic_cast<const PolynomialFunction *>(func);
+      if(!poly) {
+        throw std::runtime_error("Error in write_clexulator_data: only polynomial basis functions are supported.");
+      }
+
+      std::vector<const OccupantFunction *> args;
+      for(const auto &bset_ptr : poly->argument_bases()) {
+        for(Index i = 0; i < bset_ptr->size(); ++i) {
+          args.push_back(dynamic_cast<const OccupantFunction *>((*bset_ptr)[i]));
+          if(!args.back()) {
+            throw std::runtime_error("Error in write_clexulator_data: only occupation basis functions are supported.");
+          }
+        }
+      }
+
+      PolyTrie<double>::const_iterator it(poly->poly_coeffs().begin()), it_end(poly->poly_coeffs().end());
+      for(; it != it_end; ++it) {
+        if(almost_zero(*it)) {
+          continue;
+        }
+        ClexulatorDataTerm term;
+        term.coeff = scale * (*it);
+        for(Index i = 0; i < it.key().size(); ++i) {
+          for(Index e = 0; e < it.key()[i]; ++e) {
+            term.factor.push_back({{args[i]->dof().ID(), args[i]->basis_ind(), args[i]->occ_func_ind()}});
+          }
+        }
+        terms.push_back(term);
+      }
+    }
+
+    /// \brief Write terms as flattened arrays, as read by Clexulator_impl::DataClexulator
+    jsonParser &_data_functions_to_json(const ClexulatorDataFunctions &functions, jsonParser &json) {
+      std::vector<Index> function_begin(1, 0), term_begin(1, 0), nlist_index, sublat, occ_func_index;
+      std::vector<double> coeff;
+      for(const auto &terms : functions) {
+        for(const auto &term : terms) {
+          coeff.push_back(term.coeff);
+          for(const auto &factor : term.factor) {
+            nlist_index.push_back(factor[0]);
+            sublat.push_back(factor[1]);
+            occ_func_index.push_back(factor[2]);
+          }
+          term_begin.push_back(nlist_index.size());
+        }
+        function_begin.push_back(coeff.size());
+      }
+      json["function_begin"] = function_begin;
+      json["coeff"] = coeff;
+      json["term_begin"] = term_begin;
+      json["nlist_index"] = nlist_index;
+      json["sublat"] = sublat;
+      json["occ_func_index"] = occ_func_index;
+      return json;
+    }
+  }
+
+  /// \brief Write basis function data, for constructing a Clexulator without compilation
+  ///
+  /// - Contains the same basis functions as the Clexulator written by print_clexulator,
+  ///   as tables read by Clexulator_impl::DataClexulator
+  /// - Only occupation basis functions are supported
+  void write_clexulator_data(const Structure &prim,
+                             SiteOrbitree &tree,
+                             const PrimNeighborList &nlist,
+                             jsonParser &json,
+                             double xtal_tol) {
+
+    set_nlist_ind(prim, tree, nlist, xtal_tol);
+
+    Index N_corr(tree.basis_set_size());
+    Index Nsublat = prim.basis.size();
+
+    json.put_obj();
+    json["nlist_size"] = nlist.size();
+    json["corr_size"] = N_corr;
+    json["weight_matrix"] = nlist.weight_matrix();
+
+    // site basis function values
+    const SiteOrbitBranch &asym_unit(tree.asym_unit());
+    json["occ_func"].put_array(Nsublat, jsonParser().put_array());
+    for(Index no = 0; no < asym_unit.size(); no++) {
+      for(Index ne = 0; ne < asym_unit[no].size(); ne++) {
+        Index b = asym_unit[no][ne][0].basis_ind();
+        for(Index f = 0; f < asym_unit[no][ne].clust_basis.size(); f++) {
+          std::vector<double> values;
+          for(Index s = 0; s < asym_unit[no][ne][0].site_occupant().size(); s++) {
+            values.push_back(asym_unit[no][ne].clust_basis[f]->eval(Array<Index>(1, asym_unit[no][ne][0].site_occupant().ID()), Array<Index>(1, s)));
+          }
+          json["occ_func"][b].push_back(values);
+        }
+      }
+    }
+
+    // neighborhoods
+    std::set<UnitCellCoord> nbors;
+    neighborhood(std::inserter(nbors, nbors.begin()), tree, prim, TOL);
+    json["neighborhood"].put_array(nbors.begin(), nbors.end());
+
+    json["orbit_neighborhood"].put_array();
+    std::vector<Index> orbit_index;
+    for(Index np = 0; np < tree.size(); ++np) {
+      for(Index no = 0; no < tree[np].size(); ++no) {
+        std::set<UnitCellCoord> orbit_nbors;
+        orbit_neighborhood(std::inserter(orbit_nbors, orbit_nbors.begin()), tree, prim, np, no, TOL);
+        json["orbit_neighborhood"].push_back(jsonParser().put_array(orbit_nbors.begin(), orbit_nbors.end()));
+        orbit_index.resize(orbit_index.size() + tree.prototype(np, no).clust_basis.size(), json["orbit_neighborhood"].size() - 1);
+      }
+    }
+    json["orbit_index"] = orbit_index;
+
+    // basis functions, normalized by orbit multiplicity
+    ClexulatorDataFunctions orbit_func(N_corr);
+    std::vector<ClexulatorDataFunctions> flower_func(Nsublat, ClexulatorDataFunctions(N_corr));
+    std::vector<Index> flower_nlist_index(Nsublat);
+    for(Index b = 0; b < Nsublat; b++) {
+      flower_nlist_index[b] = find_index(nlist.sublat_indices(), b);
+    }
+
+    Index lf = 0;
+    for(Index np = 0; np < tree.size(); np++) {
+      for(Index no = 0; no < tree[np].size(); no++) {
+        SiteOrbit &orbit = tree[np][no];
+        double scale = 1.0 / orbit.size();
+
+        for(Index ne = 0; ne < orbit.size(); ne++) {
+          for(Index nf = 0; nf < orbit[ne].clust_basis.size(); nf++) {
+            if(orbit[ne].clust_basis[nf]) {
+              _add_data_terms(orbit[ne].clust_basis[nf], scale, orbit_func[lf + nf]);
+            }
+          }
+        }
+
+        // point functions include each cluster in each translation that includes the basis site
+        for(Index b = 0; b < Nsublat; b++) {
+          if(flower_nlist_index[b] == nlist.sublat_indices().size()) {
+            continue;
+          }
+          for(Index ne = 0; ne < orbit.size(); ne++) {
+            for(Index nt = 0; nt < orbit[ne].trans_nlists().size(); nt++) {
+              if(orbit[ne].trans_nlist(nt).find(flower_nlist_index[b]) == orbit[ne].size()) {
+                continue;
+              }
+              orbit[ne].set_nlist_inds(orbit[ne].trans_nlist(nt));
+              for(Index nf = 0; nf < orbit[ne].clust_basis.size(); nf++) {
+                if(orbit[ne].clust_basis[nf]) {
+                  _add_data_terms(orbit[ne].clust_basis[nf], scale, flower_func[b][lf + nf]);
+                }
+              }
+            }
+          }
+        }
+
+        lf += orbit.prototype.clust_basis.size();
+      }
+    }
+
+    _data_functions_to_json(orbit_func, json["orbit_functions"]);
+
+    json["flower_functions"].put_array();
+    for(Index b = 0; b < Nsublat; b++) {
+      if(flower_nlist_index[b] == nlist.sublat_indices().size()) {
+        json["flower_functions"].push_back(jsonParser::null());
+        continue;
+      }
+      jsonParser tjson;
+      tjson["nlist_index"] = flower_nlist_index[b];
+      json["flower_functions"].push_back(_data_functions_to_json(flower_func[b], tjson));
+    }
+  }
 
 }
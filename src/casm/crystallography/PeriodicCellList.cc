@@ -0,0 +1,163 @@
+#include "casm/crystallography/PeriodicCellList.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "casm/crystallography/Lattice.hh"
+#include "casm/crystallography/Coordinate.hh"
+
+namespace CASM {
+
+  PeriodicCellList::PeriodicCellList(const Lattice &lat, double cutoff, Index expected_size) :
+    m_lat_column_mat(lat.lat_column_mat()),
+    m_inv_lat_column_mat(lat.inv_lat_column_mat()) {
+
+    double vol = std::abs(m_lat_column_mat.determinant());
+    for(int i = 0; i < 3; i++) {
+      m_spacing(i) = vol / m_lat_column_mat.col((i + 1) % 3).cross(m_lat_column_mat.col((i + 2) % 3)).norm();
+    }
+
+    // bins are at least 'cutoff' wide, and hold about one point each
+    double width = std::max(cutoff, std::cbrt(vol / std::max(expected_size, Index(1))));
+    for(int i = 0; i < 3; i++) {
+      m_n(i) = std::max(long(1), long(std::floor(m_spacing(i) / width)));
+    }
+    m_bins.resize(m_n.prod());
+  }
+
+  //*******************************************************************************************
+
+  /// Checks every bin that may contain a point within 'radius'. Bins are indexed relative to
+  /// the bin containing the query point, which determines the periodic image of the points
+  /// in them. If the search spans more bins than there are along a lattice vector, the same
+  /// bin is checked for several periodic images.
+  template<typename Function>
+  void PeriodicCellList::_for_each_within(const Eigen::Ref<const Eigen::Vector3d> &cart, double radius, Function f) const {
+    Eigen::Vector3d frac = m_inv_lat_column_mat * cart;
+    for(int i = 0; i < 3; i++) {
+      frac(i) -= std::floor(frac(i));
+      if(frac(i) >= 1.0) {
+        frac(i) = 0.0;
+      }
+    }
+    Eigen::Vector3l center = _bin(frac);
+
+    // number of bins to search on either side of the center bin
+    Eigen::Vector3l range;
+    for(int i = 0; i < 3; i++) {
+      range(i) = long(std::ceil(radius / m_spacing(i) * m_n(i)));
+    }
+
+    Eigen::Vector3l bin, shift, offset;
+    for(offset(2) = -range(2); offset(2) <= range(2); offset(2)++) {
+      for(offset(1) = -range(1); offset(1) <= range(1); offset(1)++) {
+        for(offset(0) = -range(0); offset(0) <= range(0); offset(0)++) {
+          for(int i = 0; i < 3; i++) {
+            long t = center(i) + offset(i);
+            bin(i) = ((t % m_n(i)) + m_n(i)) % m_n(i);
+            shift(i) = (t - bin(i)) / m_n(i);
+          }
+          for(Index index : m_bins[_linear(bin)]) {
+            Eigen::Vector3d dfrac = m_frac[index] + shift.cast<double>() - frac;
+            double dist = (m_lat_column_mat * dfrac).norm();
+            if(dist <= radius) {
+              f(index, dist);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  //*******************************************************************************************
+
+  Index PeriodicCellList::insert(const Coordinate &coord) {
+    return insert(coord.const_cart());
+  }
+
+  //*******************************************************************************************
+
+  Index PeriodicCellList::insert(const Eigen::Ref<const Eigen::Vector3d> &cart) {
+    Eigen::Vector3d frac = m_inv_lat_column_mat * cart;
+    for(int i = 0; i < 3; i++) {
+      frac(i) -= std::floor(frac(i));
+      if(frac(i) >= 1.0) {
+        frac(i) = 0.0;
+      }
+    }
+    m_frac.push_back(frac);
+    m_bins[_linear(_bin(frac))].push_back(m_frac.size() - 1);
+    return m_frac.size() - 1;
+  }
+
+  //*******************************************************************************************
+
+  void PeriodicCellList::insert_cols(const Eigen::Ref<const Eigen::MatrixXd> &cart) {
+    m_frac.reserve(m_frac.size() + cart.cols());
+    for(Index i = 0; i < cart.cols(); i++) {
+      insert(cart.col(i));
+    }
+  }
+
+  //*******************************************************************************************
+
+  std::vector<Index> PeriodicCellList::within(const Eigen::Ref<const Eigen::Vector3d> &cart, double radius) const {
+    std::vector<Index> result;
+    _for_each_within(cart, radius, [&](Index index, double dist) {
+      result.push_back(index);
+    });
+
+    // a point may be found through more than one periodic image
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+  }
+
+  //*******************************************************************************************
+
+  std::vector<Index> PeriodicCellList::within(const Coordinate &coord, double radius) const {
+    return within(coord.const_cart(), radius);
+  }
+
+  //*******************************************************************************************
+
+  Index PeriodicCellList::nearest(const Eigen::Ref<const Eigen::Vector3d> &cart, double radius) const {
+    Index result = size();
+    double min_dist = radius;
+    _for_each_within(cart, radius, [&](Index index, double dist) {
+      if(result == size() || dist < min_dist) {
+        result = index;
+        min_dist = dist;
+      }
+    });
+    return result;
+  }
+
+  //*******************************************************************************************
+
+  Index PeriodicCellList::nearest(const Coordinate &coord, double radius) const {
+    return nearest(coord.const_cart(), radius);
+  }
+
+  //*******************************************************************************************
+
+  std::vector<Index> PeriodicCellList::nearest_cols(const Eigen::Ref<const Eigen::MatrixXd> &cart, double radius) const {
+    std::vector<Index> result;
+    result.reserve(cart.cols());
+    for(Index i = 0; i < cart.cols(); i++) {
+      result.push_back(nearest(cart.col(i), radius));
+    }
+    return result;
+  }
+
+  //*******************************************************************************************
+
+  Eigen::Vector3l PeriodicCellList::_bin(const Eigen::Vector3d &frac) const {
+    Eigen::Vector3l result;
+    for(int i = 0; i < 3; i++) {
+      result(i) = std::min(m_n(i) - 1, long(std::floor(frac(i) * m_n(i))));
+    }
+    return result;
+  }
+
+}
@@ -9,6 +9,7 @@
 #include "casm/clusterography/Orbitree.hh"
 #include "casm/clusterography/jsonClust.hh"
 #include "casm/misc/algorithm.hh"
+#include "casm/crystallography/PeriodicCellList.hh"
 
 
 namespace CASM {
@@ -271,6 +272,7 @@ namespace CASM {
 
     basis.clear();
     Coordinate tcoord(lattice());
+    PeriodicCellList cell_list(lattice(), map_tol, prim.basis.size() * prim_grid.size());
 
     //loop over basis sites of prim
     for(j = 0; j < prim.basis.size(); j++) {
@@ -286,12 +288,19 @@ namespace CASM {
         basis.back().set_lattice(lattice(), CART);
 
         basis.back().within();
-        for(Index k = 0; k < basis.size() - 1; k++) {
+        bool is_new = true;
+        for(Index k : cell_list.within(basis.back(), map_tol)) {
           if(basis[k].compare(basis.back(), map_tol)) {
-            basis.pop_back();
+            is_new = false;
             break;
           }
         }
+        if(is_new) {
+          cell_list.insert(basis.back());
+        }
+        else {
+          basis.pop_back();
+        }
       }
     }
     //std::cout << "WORKING ON FACTOR GROUP " << &m_factor_group << " for structure with volume " << prim_grid.size() << ":\n";
@@ -557,6 +557,10 @@ namespace CASM {
 
     m_lat.generate_point_group(m_point_group, tol);
 
+    Eigen::Matrix3d lat = m_lat.lat_column_mat();
+    for(Index i = 0; i < m_point_group.size(); i++) {
+      m_frac_point_group.push_back(iround(lat.inverse() * m_point_group[i].matrix() * lat));
+    }
   }
 
   template<>
@@ -574,6 +578,11 @@ namespace CASM {
     if(m_gen_mat.determinant() < 1) {
       throw std::runtime_error("The transformation matrix to expand into a 3x3 matrix must have a positive determinant!");
     }
+
+    Eigen::Matrix3d lat = m_lat.lat_column_mat();
+    for(Index i = 0; i < m_point_group.size(); i++) {
+      m_frac_point_group.push_back(iround(lat.inverse() * m_point_group[i].matrix() * lat));
+    }
   }
 
 
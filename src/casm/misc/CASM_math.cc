@@ -455,6 +455,96 @@ namespace CASM {
     return tot_cost;
   }
 
+  //*******************************************************************************************
+  /**
+   * Solves the assignment problem by successive shortest augmenting paths (Jonker-Volgenant),
+   * adding one row at a time while maintaining feasible row and column potentials. After adding
+   * each row, the current partial assignment is optimal for the rows added so far. With
+   * non-negative costs, its cost is a lower bound on the total optimal cost, so the search
+   * stops early once that exceeds 'max_cost'.
+   *
+   * Costs greater than 1E10 are treated as forbidden assignments, as in the Munkres version.
+   *
+   * \returns total optimal cost; 1e20 if no assignment avoids forbidden costs; or a lower bound
+   *          greater than 'max_cost' if the search stopped early. In the last two cases
+   *          optimal_assignment is empty.
+   */
+  double hungarian_method(const Eigen::MatrixXd &cost_matrix, std::vector<Index> &optimal_assignment, const double _tol, const double max_cost) {
+    double _infinity = 1E10;
+    Index dim = cost_matrix.rows();
+
+    // use 1-based indexing for rows and columns, with column 0 used as the root of each augmenting path
+    // row_of[j]: row assigned to column j (0 if unassigned)
+    std::vector<double> u(dim + 1, 0.0), v(dim + 1, 0.0), min_slack(dim + 1);
+    std::vector<Index> row_of(dim + 1, 0), prev_col(dim + 1, 0);
+    std::vector<bool> visited(dim + 1);
+
+    optimal_assignment.clear();
+    for(Index i = 1; i <= dim; i++) {
+      row_of[0] = i;
+      Index j0 = 0;
+      std::fill(min_slack.begin(), min_slack.end(), std::numeric_limits<double>::max());
+      std::fill(visited.begin(), visited.end(), false);
+
+      // grow the shortest path tree until it reaches an unassigned column
+      do {
+        visited[j0] = true;
+        Index i0 = row_of[j0];
+        Index j1 = 0;
+        double delta = std::numeric_limits<double>::max();
+        for(Index j = 1; j <= dim; j++) {
+          if(visited[j]) {
+            continue;
+          }
+          double slack = cost_matrix(i0 - 1, j - 1) - u[i0] - v[j];
+          if(slack < min_slack[j]) {
+            min_slack[j] = slack;
+            prev_col[j] = j0;
+          }
+          if(min_slack[j] < delta) {
+            delta = min_slack[j];
+            j1 = j;
+          }
+        }
+        for(Index j = 0; j <= dim; j++) {
+          if(visited[j]) {
+            u[row_of[j]] += delta;
+            v[j] -= delta;
+          }
+          else {
+            min_slack[j] -= delta;
+          }
+        }
+        j0 = j1;
+      }
+      while(row_of[j0] != 0);
+
+      // augment along the path
+      do {
+        Index j1 = prev_col[j0];
+        row_of[j0] = row_of[j1];
+        j0 = j1;
+      }
+      while(j0 != 0);
+
+      // -v[0] is the optimal cost of assigning rows 1..i
+      if(-v[0] > _infinity) {
+        return 1e20;
+      }
+      if(-v[0] > max_cost) {
+        return -v[0];
+      }
+    }
+
+    optimal_assignment.assign(dim, -1);
+    double tot_cost = 0.0;
+    for(Index j = 1; j <= dim; j++) {
+      optimal_assignment[row_of[j] - 1] = j - 1;
+      tot_cost += cost_matrix(row_of[j] - 1, j - 1);
+    }
+    return tot_cost;
+  }
+
   namespace HungarianMethod_impl {
     //*******************************************************************************************
     /**
@@ -0,0 +1,25 @@
+#include "casm/misc/PhiloxRand.hh"
+
+#include "casm/casm_io/jsonParser.hh"
+
+namespace CASM {
+
+  /// \brief Write PhiloxRand state: {"seed": int, "stream": int, "position": int}
+  jsonParser &to_json(const PhiloxRand &rand, jsonParser &json) {
+    json.put_obj();
+    json["seed"] = rand.seed();
+    json["stream"] = rand.stream();
+    json["position"] = rand.position();
+    return json;
+  }
+
+  /// \brief Read PhiloxRand state: {"seed": int, "stream": int (default 0), "position": int (default 0)}
+  void from_json(PhiloxRand &rand, const jsonParser &json) {
+    PhiloxRand::uint64 stream, position;
+    json.get_else<PhiloxRand::uint64>(stream, "stream", 0);
+    json.get_else<PhiloxRand::uint64>(position, "position", 0);
+    rand.seed(json["seed"].get<PhiloxRand::uint64>(), stream);
+    rand.set_position(position);
+  }
+
+}
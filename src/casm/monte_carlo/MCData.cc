@@ -34,7 +34,7 @@ namespace CASM {
   ///  If these conditions can not be met,
   ///    set: m_is_equilibrated = false; m_equil_samples = N-1;
   ///
-  MCDataEquilibration::MCDataEquilibration(const Eigen::VectorXd &observations, double prec) {
+  MCDataEquilibration::MCDataEquilibration(const Eigen::Ref<const Eigen::VectorXd> &observations, double prec) {
 
     size_type start1, start2, N;
     double sum1, sum2;
@@ -106,6 +106,96 @@ namespace CASM {
   }
 
 
+  /// \brief Update equilibration check for observations added since the last update
+  ///
+  /// \param observations All observations, including those included by previous updates
+  /// \param prec Desired absolute precision (<X> +/- prec)
+  ///
+  /// Uses the same partitioning algorithm as the constructor, but keeps the partitions
+  /// between updates and continues incrementing start1 from where the last update left it.
+  ///
+  /// If start1 can not be incremented enough to satisfy (std::abs(mean1 - mean2) < prec),
+  /// the observations are not equilibrated, the partitions are reset to start1 = 0, and
+  /// they are not checked again until the number of observations has increased by 10%.
+  /// This keeps the amortized cost of updating after each observation O(1).
+  ///
+  void MCDataEquilibration::update(const Eigen::Ref<const Eigen::VectorXd> &observations, double prec) {
+
+    size_type N = observations.size();
+    if(N < m_size) {
+      clear();
+    }
+    if(N == 0) {
+      return;
+    }
+
+    // add new observations to the second partition
+    double eps = (observations(0) == 0.0) ? 1e-8 : std::abs(observations(0)) * 1e-8;
+    for(size_type i = m_size; i < N; i++) {
+      if(std::abs(observations(i) - observations(0)) > eps) {
+        m_all_same = false;
+      }
+      m_sum += observations(i);
+      m_sum2 += observations(i);
+    }
+    m_size = N;
+
+    if(m_all_same) {
+      m_is_equilibrated = true;
+      m_equil_samples = 0;
+      return;
+    }
+
+    m_is_equilibrated = false;
+    m_equil_samples = N - 1;
+    if(N < m_next_check) {
+      return;
+    }
+
+    // increment start1 (and update start2, sum1, and sum2) until abs(mean1 - mean2) < prec
+    _balance(observations);
+    while(std::abs((m_sum1 / (m_start2 - m_start1)) - (m_sum2 / (N - m_start2))) > prec) {
+      if(m_start1 >= N - 2) {
+        m_start1 = 0;
+        m_start2 = 0;
+        m_sum1 = 0.0;
+        m_sum2 = m_sum;
+        m_next_check = N + N / 10 + 1;
+        return;
+      }
+      m_sum1 -= observations(m_start1);
+      m_start1++;
+      _balance(observations);
+    }
+
+    // ensure that there are values on either side of the total mean
+    double mean_tot = (m_sum1 + m_sum2) / (N - m_start1);
+    size_type start1 = m_start1;
+
+    if(observations(start1) < mean_tot) {
+      while(observations(start1) < mean_tot && start1 < N - 1)
+        start1++;
+    }
+    else {
+      while(observations(start1) > mean_tot && start1 < N - 1)
+        start1++;
+    }
+
+    m_is_equilibrated = (start1 < N - 1);
+    m_equil_samples = start1;
+  }
+
+  /// \brief Move start2 so that the first partition has ceil((m_size - start1)/2) elements
+  void MCDataEquilibration::_balance(const Eigen::Ref<const Eigen::VectorXd> &observations) {
+    size_type target = m_start1 + (m_size - m_start1 + 1) / 2;
+    while(m_start2 < target) {
+      m_sum1 += observations(m_start2);
+      m_sum2 -= observations(m_start2);
+      m_start2++;
+    }
+  }
+
+
   /// \brief Check convergence of a range of observations
   ///
   /// \param observations An Eigen::VectorXd of observations
@@ -124,7 +214,7 @@ namespace CASM {
   /// - CoVar[i] = ( (1.0/(observations.size()-i))*sum_j(j=0:L-i-1, observations(j)*observations(j+1)) ) - sqr(observations.mean());
   /// - rho = pow(2.0, -1.0/i), using min i such that CoVar[i]/CoVar[0] < 0.5
   ///
-  MCDataConvergence::MCDataConvergence(const Eigen::VectorXd &observations, double conf) :
+  MCDataConvergence::MCDataConvergence(const Eigen::Ref<const Eigen::VectorXd> &observations, double conf) :
     m_is_converged(false),
     m_mean(observations.mean()),
     m_squared_norm(observations.squaredNorm()) {
@@ -152,9 +242,8 @@ namespace CASM {
     m_calculated_prec = z_alpha * sqrt(var_of_mean);
   }
 
-  double covariance(const Eigen::VectorXd &X, const Eigen::VectorXd &Y, double mean) {
-    Eigen::VectorXd vmean = Eigen::VectorXd::Ones(X.size()) * mean;
-    return (X - vmean).dot(Y - vmean) / X.size();
+  double covariance(const Eigen::Ref<const Eigen::VectorXd> &X, const Eigen::Ref<const Eigen::VectorXd> &Y, double mean) {
+    return (X.array() - mean).matrix().dot((Y.array() - mean).matrix()) / X.size();
   }
 
 
@@ -162,7 +251,7 @@ namespace CASM {
   ///
   /// \returns std::tuple<bool, double> : (found_rho?, rho)
   ///
-  std::tuple<bool, double, double> MCDataConvergence::_calc_rho(const Eigen::VectorXd &observations) {
+  std::tuple<bool, double, double> MCDataConvergence::_calc_rho(const Eigen::Ref<const Eigen::VectorXd> &observations) {
 
     size_type N = observations.size();
     double CoVar0 = m_squared_norm / N - m_mean * m_mean;
@@ -189,4 +278,57 @@ namespace CASM {
     return std::make_tuple(false, 0.0, CoVar0);
   }
 
+
+  /// \brief Add an observation
+  ///
+  /// - Each block mean is added to its level, then paired with the previous
+  ///   unpaired block mean of the same level to form a block of the next level
+  ///
+  void MCDataBlocking::push_back(double value) {
+    m_size++;
+    m_sum += value;
+    m_squared_norm += value * value;
+
+    double block_mean = value;
+    for(size_type k = 0; ; k++) {
+      if(k == m_level.size()) {
+        m_level.emplace_back();
+      }
+      Level &level = m_level[k];
+      level.count++;
+      level.sum += block_mean;
+      level.sum_sq += block_mean * block_mean;
+      if(!level.has_pending) {
+        level.has_pending = true;
+        level.pending = block_mean;
+        return;
+      }
+      level.has_pending = false;
+      block_mean = 0.5 * (level.pending + block_mean);
+    }
+  }
+
+  /// \brief Var(<X>), estimated by blocking, or infinity if there are fewer than min_blocks observations
+  double MCDataBlocking::var_of_mean() const {
+    double result = -1.0;
+    for(const Level &level : m_level) {
+      if(level.count < min_blocks) {
+        break;
+      }
+      double mean = level.sum / level.count;
+      double var = std::max(0.0, level.sum_sq / level.count - mean * mean);
+      result = std::max(result, var / (level.count - 1));
+    }
+    if(result < 0.0) {
+      return 1.0 / 0.0;
+    }
+    return result;
+  }
+
+  /// \brief Calculated precision of <X>
+  double MCDataBlocking::calculated_precision(double conf) const {
+    double z_alpha = sqrt(2.0) * boost::math::erf_inv(conf);
+    return z_alpha * sqrt(var_of_mean());
+  }
+
 }
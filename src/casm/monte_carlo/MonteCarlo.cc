@@ -1,5 +1,6 @@
 #include "casm/monte_carlo/MonteCarlo.hh"
 #include "casm/clex/Configuration.hh"
+#include "casm/external/MersenneTwister/MersenneTwister.h"
 
 namespace CASM {
 
@@ -28,20 +29,69 @@ namespace CASM {
   /// \brief Samples all requested property data, and stores pass and step number sample was taken at
   void MonteCarlo::sample_data(const MonteCounter &counter) {
 
-    // call MonteSamper::sample(*this) for all samplers
-    for(auto it = m_sampler.begin(); it != m_sampler.end(); ++it) {
-      it->second->sample(*this, counter);
+    if(!m_sample_plan_ready) {
+      _make_sample_plan();
+    }
+
+    // read values directly for samplers of property elements
+    for(auto &entry : m_sample_plan) {
+      const MonteSampler::SampleSource &source = entry.first;
+      double value = source.scalar ? *source.scalar : (*source.vector)(source.index);
+      entry.second->data().push_back(value / source.norm);
+    }
+
+    // call MonteSamper::sample(*this) for all other samplers
+    for(auto sampler : m_sample_custom) {
+      sampler->sample(*this, counter);
     }
     m_sample_time.push_back(std::make_pair(counter.pass(), counter.step()));
 
     if(m_write_trajectory) {
-      m_trajectory.push_back(configdof());
+      if(m_trajectory.empty()) {
+        m_trajectory.push_back(CompactOccupation(supercell()));
+      }
+      else {
+        m_trajectory.push_back(m_trajectory.back());
+      }
+      m_trajectory.back().set_occupation(configdof().occupation());
     }
 
     m_is_equil_uptodate = false;
     m_is_converged_uptodate = false;
   }
 
+  /// \brief Snapshot 'i' of the Monte Carlo calculation, as a ConfigDoF
+  ///
+  /// - Only the occupation is stored for each snapshot, the other DoF are those of
+  ///   the current ConfigDoF, which do not change during the calculation
+  ConfigDoF MonteCarlo::trajectory_configdof(Index i) const {
+    ConfigDoF result = configdof();
+    result.set_occupation(m_trajectory[i].occupation());
+    return result;
+  }
+
+  /// \brief Construct m_sample_plan and m_sample_custom
+  ///
+  /// - Samplers that provide a MonteSampler::SampleSource are sampled by reading the
+  ///   property value directly
+  /// - m_sampler is sorted by SamplerNameCompare, so elements of a vector property
+  ///   such as "corr" are read sequentially
+  void MonteCarlo::_make_sample_plan() {
+    m_sample_plan.clear();
+    m_sample_custom.clear();
+    for(auto it = m_sampler.begin(); it != m_sampler.end(); ++it) {
+      MonteSampler::SampleSource source = it->second->sample_source(*this);
+      if(source.scalar || source.vector) {
+        m_sample_plan.push_back(std::make_pair(source, &(*it->second)));
+      }
+      else {
+        m_sample_custom.push_back(&(*it->second));
+      }
+    }
+
+    m_sample_plan_ready = true;
+  }
+
   /// \brief Clear all data from all samplers
   void MonteCarlo::clear_samples() {
     for(auto it = m_sampler.begin(); it != m_sampler.end(); ++it) {
@@ -55,6 +105,91 @@ namespace CASM {
     m_next_convergence_check = m_convergence_check_period;
   }
 
+  /// \brief Write samples, trajectory, and random number generator state, to checkpoint a calculation
+  ///
+  /// Writes:
+  /// \code
+  /// {
+  ///   "random": {"seed": int, "stream": int, "position": int},
+  ///   "sample_times": [[pass, step], ...],
+  ///   "next_convergence_check": int,
+  ///   "samplers": {"formation_energy": [...], "corr(12)": [...], ...},
+  ///   "trajectory": [configdof, ...]  // if writing trajectory
+  /// }
+  /// \endcode
+  ///
+  /// - The ConfigDoF is not included, so that derived classes may save it with
+  ///   any other state they require
+  jsonParser &MonteCarlo::write_checkpoint(jsonParser &json) const {
+    json.put_obj();
+    to_json(m_random, json["random"]);
+
+    jsonParser &times = json["sample_times"].put_array();
+    for(const auto &t : m_sample_time) {
+      jsonParser tmp;
+      tmp.put_array();
+      tmp.push_back(t.first);
+      tmp.push_back(t.second);
+      times.push_back(tmp);
+    }
+    json["next_convergence_check"] = m_next_convergence_check;
+
+    jsonParser &samplers = json["samplers"].put_obj();
+    for(auto it = m_sampler.cbegin(); it != m_sampler.cend(); ++it) {
+      auto obs = it->second->data().observations();
+      samplers[it->first].put_array(obs.data(), obs.data() + obs.size());
+    }
+
+    if(m_write_trajectory) {
+      jsonParser &traj = json["trajectory"].put_array();
+      for(Index i = 0; i < m_trajectory.size(); i++) {
+        jsonParser tmp;
+        traj.push_back(to_json(trajectory_configdof(i), tmp));
+      }
+    }
+    return json;
+  }
+
+  /// \brief Restore samples, trajectory, and random number generator state written by write_checkpoint
+  ///
+  /// - Does not change the ConfigDoF, which should be set first (for example by the derived
+  ///   class 'set_state'), because that clears the samples
+  /// - Equilibration and convergence are re-checked using the restored observations
+  void MonteCarlo::read_checkpoint(const jsonParser &json) {
+
+    clear_samples();
+
+    from_json(m_random, json["random"]);
+
+    for(const auto &t : json["sample_times"]) {
+      m_sample_time.push_back(std::make_pair(t[0].get<MonteCounter::size_type>(), t[1].get<MonteCounter::size_type>()));
+    }
+    m_next_convergence_check = json["next_convergence_check"].get<MonteSampler::size_type>();
+
+    for(auto it = m_sampler.begin(); it != m_sampler.end(); ++it) {
+      auto sampler_it = json["samplers"].find(it->first);
+      if(sampler_it == json["samplers"].end() || sampler_it->size() != m_sample_time.size()) {
+        throw std::runtime_error(
+          std::string("Error in 'MonteCarlo::read_checkpoint'\n") +
+          "  Checkpoint does not match the requested sampling: " + it->first);
+      }
+      MCData &data = it->second->data();
+      for(const auto &val : *sampler_it) {
+        data.push_back(val.get<double>());
+      }
+    }
+
+    if(m_write_trajectory && json.contains("trajectory")) {
+      CompactOccupation snapshot(supercell());
+      ConfigDoF tmp = configdof();
+      for(const auto &dof : json["trajectory"]) {
+        from_json(tmp, dof);
+        snapshot.set_occupation(tmp.occupation());
+        m_trajectory.push_back(snapshot);
+      }
+    }
+  }
+
   /// \brief Returns pair(true, equil_samples) if required equilibration has occured for all samplers that must converge
   ///
   /// - equil_samples is the number of samples required for all samplers that must equilibrate to equilibrate
@@ -182,6 +317,12 @@ namespace CASM {
     return m_is_converged;
   }
 
+  /// \brief Choose a random seed, using /dev/urandom if available
+  PhiloxRand::uint64 MonteCarlo::_random_seed() {
+    MTRand mtrand;
+    return (PhiloxRand::uint64(mtrand.randInt()) << 32) + mtrand.randInt();
+  }
+
   /// \brief Returns true if a convergence check is due
   ///
   /// Currently set to every 10 samples
@@ -13,6 +13,53 @@ namespace CASM {
     }
   }
 
+  /// \brief Insert Monte Carlo configuration in canonical form, if it is not known to be rejected
+  ///
+  /// Finding the canonical form is expensive, so it is skipped if:
+  /// - the score is not good enough for the hall of fame. The score is calculated
+  ///   for 'config' as is, assuming the metric is invariant to symmetry operations.
+  /// - 'config' has the same occupation as a configuration already inserted, or
+  ///   excluded, whose score is good enough for the hall of fame
+  ///
+  /// The occupations are only compared for configurations with no displacement or
+  /// strain DoF, and all configurations inserted this way must be in the same
+  /// supercell, as for the configurations sampled during Monte Carlo.
+  MonteCarloEnum::HallOfFameType::InsertResult MonteCarloEnum::_insert_canonical(const Configuration &config) {
+
+    double score = _halloffame().score(config);
+    if(!m_halloffame->check_score(score)) {
+      return HallOfFameType::InsertResult(m_halloffame->end(), false, score, false, m_halloffame->end());
+    }
+
+    const ConfigDoF &configdof = config.configdof();
+    bool occ_only = !configdof.has_displacement() && !configdof.has_deformation();
+    std::vector<int> occ;
+    if(occ_only) {
+      occ.assign(configdof.occupation().begin(), configdof.occupation().end());
+      if(m_known_occ.count(occ)) {
+        return HallOfFameType::InsertResult(m_halloffame->end(), false, score, false, m_halloffame->end());
+      }
+    }
+
+    auto res = m_halloffame->insert(config.in_canonical_supercell().canonical_form(), score);
+
+    if(occ_only) {
+      // forget configurations that can no longer enter the hall of fame
+      if(Index(m_known_occ.size()) > 10 * (m_halloffame->max_size() + 1)) {
+        for(auto it = m_known_occ.begin(); it != m_known_occ.end();) {
+          if(!m_halloffame->check_score(it->second)) {
+            it = m_known_occ.erase(it);
+          }
+          else {
+            ++it;
+          }
+        }
+      }
+      m_known_occ[occ] = score;
+    }
+    return res;
+  }
+
   /// \brief Attempt to insert Configuration into enumeration hall of fame
   ///
   /// \returns Pair of iterator pointing to inserted Configuration (or end), and
@@ -42,7 +89,7 @@ namespace CASM {
                m_halloffame->end());
     }
 
-    auto res = _insert(config);
+    auto res = insert_canonical() ? _insert_canonical(config) : m_halloffame->insert(config);
 
     if(debug()) {
       _log().custom("Config enumeration");
@@ -57,7 +104,7 @@ namespace CASM {
           _log() << "already in hall of fame: #" << std::distance(m_halloffame->begin(), res.pos) << std::endl;
         }
         else {
-          _log() << "score not good enough" << std::endl;
+          _log() << "score not good enough, or already found" << std::endl;
         }
       }
       _log() << std::endl;
@@ -209,12 +256,58 @@ namespace CASM {
   /// \brief Clear hall of fame and reset excluded
   void MonteCarloEnum::reset() {
     m_halloffame->clear();
+    m_known_occ.clear();
     if(check_existence()) {
       m_halloffame->clear_excluded();
       m_halloffame->exclude(this->primclex().config_begin(), this->primclex().config_end());
     }
   }
 
+  /// \brief Write the hall of fame configurations, to checkpoint a calculation
+  ///
+  /// Writes an array of:
+  /// \code
+  /// {"transf_mat": supercell transformation matrix, "configdof": configdof}
+  /// \endcode
+  jsonParser &MonteCarloEnum::write_checkpoint(jsonParser &json) const {
+    json.put_array();
+    for(const auto &val : halloffame()) {
+      jsonParser tmp;
+      tmp["transf_mat"] = val.second.get_supercell().get_transf_mat();
+      to_json(val.second.configdof(), tmp["configdof"]);
+      json.push_back(tmp);
+    }
+    return json;
+  }
+
+  /// \brief Re-insert hall of fame configurations written by write_checkpoint
+  ///
+  /// \param json Hall of fame configurations, as written by write_checkpoint
+  /// \param mc_config The current Monte Carlo configuration, used for configurations
+  ///        in the Monte Carlo supercell
+  ///
+  /// - Scores are re-calculated, and the enumeration check is not repeated
+  /// - Does not reset the hall of fame or excluded configurations
+  void MonteCarloEnum::read_checkpoint(const jsonParser &json, const Configuration &mc_config) {
+    for(const auto &val : json) {
+      Eigen::Matrix3i transf_mat;
+      from_json(transf_mat, val["transf_mat"]);
+
+      if(transf_mat == mc_config.get_supercell().get_transf_mat()) {
+        Configuration config(mc_config);
+        from_json(config.configdof(), val["configdof"]);
+        _insert(config);
+      }
+      else {
+        Lattice lat = make_supercell(primclex().get_prim().lattice(), transf_mat);
+        Supercell &scel = _primclex().get_supercell(_primclex().add_supercell(lat));
+        ConfigDoF configdof = mc_config.configdof();
+        from_json(configdof, val["configdof"]);
+        _insert(Configuration(scel, jsonParser(), configdof));
+      }
+    }
+  }
+
   MonteCarloEnum::HallOfFameType &MonteCarloEnum::_halloffame() {
     if(m_halloffame) {
       return *m_halloffame;
@@ -108,6 +108,12 @@ namespace CASM {
   }
 
 
+  /// \brief Number of passes or steps since the last sample was taken
+  MonteCounter::size_type MonteCounter::since_last_sample() const {
+    return m_since_last_sample;
+  }
+
+
   void MonteCounter::increment_samples() {
     m_samples++;
     m_since_last_sample = 0;
@@ -126,7 +132,7 @@ namespace CASM {
   }
 
   /// \brief Set all counter variables for performing a restart
-  void MonteCounter::set(size_type _pass, size_type _step, size_type _samples) {
+  void MonteCounter::set(size_type _pass, size_type _step, size_type _samples, size_type _since_last_sample) {
 
     reset();
 
@@ -135,6 +141,8 @@ namespace CASM {
 
     m_samples = _samples;
 
+    m_since_last_sample = _since_last_sample;
+
   }
 
 
@@ -43,12 +43,10 @@ namespace CASM {
 
     // cov = <X*Y> - <X>*<Y>
     const MonteSampler &sampler1 = *(mc->samplers().find(prop_name1)->second);
-    const Eigen::VectorXd &obs1 = sampler1.data().observations();
-    const Eigen::VectorXd &X = obs1.segment(equil.second, obs1.size() - equil.second);
+    auto X = sampler1.data().observations().tail(sampler1.data().size() - equil.second);
 
     const MonteSampler &sampler2 = *(mc->samplers().find(prop_name2)->second);
-    const Eigen::VectorXd &obs2 = sampler2.data().observations();
-    const Eigen::VectorXd &Y = obs2.segment(equil.second, obs2.size() - equil.second);
+    auto Y = sampler2.data().observations().tail(sampler2.data().size() - equil.second);
 
     double Xsum = 0.0;
     double Ysum = 0.0;
@@ -337,8 +335,8 @@ namespace CASM {
           json["Pass"].push_back(it->first);
           json["Step"].push_back(it->second);
         }
-        for(auto it = mc.trajectory().cbegin(); it != mc.trajectory().cend(); ++it) {
-          json["DoF"].push_back(*it);
+        for(Index i = 0; i < mc.trajectory().size(); ++i) {
+          json["DoF"].push_back(mc.trajectory_configdof(i));
         }
         gz::ogzstream sout((dir.trajectory_json(cond_index).string() + ".gz").c_str());
         _log << "write: " << fs::path(dir.trajectory_json(cond_index).string() + ".gz") << "\n";
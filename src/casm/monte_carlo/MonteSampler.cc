@@ -68,6 +68,13 @@ namespace CASM {
     data().push_back(mc.scalar_property(m_property_name));
   }
 
+  /// \brief Location of the sampled value
+  MonteSampler::SampleSource ScalarMonteSampler::sample_source(const MonteCarlo &mc) const {
+    SampleSource source;
+    source.scalar = &mc.scalar_property(m_property_name);
+    return source;
+  }
+
 
 
   // ---- VectorMonteSampler Definitions ---------------------------------
@@ -113,6 +120,14 @@ namespace CASM {
     data().push_back(mc.vector_property(m_property_name)(m_index));
   }
 
+  /// \brief Location of the sampled value
+  MonteSampler::SampleSource VectorMonteSampler::sample_source(const MonteCarlo &mc) const {
+    SampleSource source;
+    source.vector = &mc.vector_property(m_property_name);
+    source.index = m_index;
+    return source;
+  }
+
 
   // ---- QueryMonteSampler Definitions --------------------------------
 
@@ -204,8 +219,8 @@ namespace CASM {
   /// \brief Sample data from a MonteCarlo calculation
   void CompMonteSampler::sample(const MonteCarlo &mc, const MonteCounter &counter) {
 
-    auto comp_n = mc.vector_property("comp_n");
-    auto comp = m_comp_converter.param_composition(comp_n);
+    const Eigen::VectorXd &comp_n = mc.vector_property("comp_n");
+    Eigen::VectorXd comp = m_comp_converter.param_composition(comp_n);
 
     data().push_back(comp(m_index));
 
@@ -255,6 +270,15 @@ namespace CASM {
     data().push_back(mc.vector_property("comp_n")(m_index) / m_basis_size);
   }
 
+  /// \brief Location of the sampled value
+  MonteSampler::SampleSource SiteFracMonteSampler::sample_source(const MonteCarlo &mc) const {
+    SampleSource source;
+    source.vector = &mc.vector_property("comp_n");
+    source.index = m_index;
+    source.norm = m_basis_size;
+    return source;
+  }
+
 
   // ---- AtomFracMonteSampler Definitions ---------------------------------
 
@@ -297,14 +321,15 @@ namespace CASM {
   /// \brief Sample data from a MonteCarlo calculation
   void AtomFracMonteSampler::sample(const MonteCarlo &mc, const MonteCounter &counter) {
 
+    const Eigen::VectorXd &comp_n = mc.vector_property("comp_n");
     double atom_sum = 0.0;
-    for(size_type i = 0; i < mc.vector_property("comp_n").size(); ++i) {
+    for(size_type i = 0; i < comp_n.size(); ++i) {
       if(i != m_vacancy_index) {
-        atom_sum += mc.vector_property("comp_n")(i);
+        atom_sum += comp_n(i);
       }
     }
 
-    data().push_back(mc.vector_property("comp_n")(m_index) / atom_sum);
+    data().push_back(comp_n(m_index) / atom_sum);
   }
 
 }
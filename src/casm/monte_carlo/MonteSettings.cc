@@ -123,6 +123,55 @@ namespace CASM {
     return _get_setting<bool>("driver", "dependent_runs", help);
   }
 
+  /// \brief Returns true if a random number generator seed has been specified
+  bool MonteSettings::is_random_seed() const {
+    return _is_setting("driver", "random_seed");
+  }
+
+  /// \brief Random number generator seed
+  unsigned long MonteSettings::random_seed() const {
+    std::string help = "int (optional)\n"
+                       "  Seed for the random number generator. If not given, a seed is chosen\n"
+                       "    randomly. The seed used is written to \"conditions.i/random.json\".\n";
+    return _get_setting<unsigned long>("driver", "random_seed", help);
+  }
+
+  /// \brief Random number generator stream. Default 0.
+  unsigned long MonteSettings::random_stream() const {
+    if(!_is_setting("driver", "random_stream")) {
+      return 0;
+    }
+    std::string help = "int (default=0)\n"
+                       "  Random number generator stream. Calculations with the same seed and \n"
+                       "    different streams use independent random numbers.\n";
+    return _get_setting<unsigned long>("driver", "random_stream", help);
+  }
+
+  /// \brief Returns true if periodic checkpoints of unfinished calculations are requested
+  bool MonteSettings::is_checkpoint() const {
+    return _is_setting("driver", "checkpoint");
+  }
+
+  /// \brief Number of passes between checkpoints. Default 0 (none).
+  MonteSettings::size_type MonteSettings::checkpoint_period_passes() const {
+    if(!_is_setting("driver", "checkpoint", "passes")) {
+      return 0;
+    }
+    std::string help = "int (optional)\n"
+                       "  Number of passes between checkpoints of an unfinished calculation.\n";
+    return _get_setting<size_type>("driver", "checkpoint", "passes", help);
+  }
+
+  /// \brief Wall time (s) between checkpoints. Default 0.0 (none).
+  double MonteSettings::checkpoint_period_time() const {
+    if(!_is_setting("driver", "checkpoint", "time")) {
+      return 0.0;
+    }
+    std::string help = "number (optional)\n"
+                       "  Wall time, in seconds, between checkpoints of an unfinished calculation.\n";
+    return _get_setting<double>("driver", "checkpoint", "time", help);
+  }
+
   /// \brief Directory where output should go
   const fs::path MonteSettings::output_directory() const {
     return m_output_directory;
@@ -3,6 +3,7 @@
 #include "casm/monte_carlo/OccCandidate.hh"
 #include "casm/clex/Configuration.hh"
 #include "casm/external/MersenneTwister/MersenneTwister.h"
+#include "casm/misc/PhiloxRand.hh"
 
 
 namespace CASM {
@@ -112,11 +113,46 @@ namespace CASM {
       return m_l_to_mol[l];
     }
 
+    /// Mol.id of all mutating sites, by OccCandidate type: loc()[cand_index][loc] -> Mol.id
+    const std::vector<std::vector<Index> > &OccLocation::loc() const {
+      return m_loc;
+    }
+
+    /// Reorder Mol of each OccCandidate type, for example to restart a calculation exactly
+    ///
+    /// - The order of Mol in each OccCandidate list determines which sites are chosen by
+    ///   propose_canonical and propose_grand_canonical, but depends on the history of
+    ///   applied events, not only the current configuration
+    /// - '_loc' must contain the same Mol of each OccCandidate type as the current lists,
+    ///   for example as given by loc() for the same configuration
+    void OccLocation::set_loc(const std::vector<std::vector<Index> > &_loc) {
+      if(_loc.size() != m_loc.size()) {
+        throw std::runtime_error("Error in OccLocation::set_loc: number of OccCandidate does not match");
+      }
+      for(Index cand_index = 0; cand_index < m_loc.size(); ++cand_index) {
+        if(_loc[cand_index].size() != m_loc[cand_index].size()) {
+          throw std::runtime_error("Error in OccLocation::set_loc: OccCandidate sizes do not match");
+        }
+        for(Index id : _loc[cand_index]) {
+          if(id < 0 || id >= m_mol.size() || m_loc[cand_index][m_mol[id].loc] != id) {
+            throw std::runtime_error("Error in OccLocation::set_loc: Mol do not match OccCandidate type");
+          }
+        }
+      }
+      m_loc = _loc;
+      for(Index cand_index = 0; cand_index < m_loc.size(); ++cand_index) {
+        for(Index i = 0; i < m_loc[cand_index].size(); ++i) {
+          m_mol[m_loc[cand_index][i]].loc = i;
+        }
+      }
+    }
+
     /// Propose canonical OccEvent
+    template<typename RandomGenerator>
     OccEvent &OccLocation::propose_canonical(
       OccEvent &e,
       const std::vector<OccSwap> &canonical_swap,
-      MTRand &mtrand) const {
+      RandomGenerator &random) const {
 
       Index tsize = canonical_swap.size();
       m_tsum.resize(tsize + 1);
@@ -128,11 +164,11 @@ namespace CASM {
                         ((double) cand_size(canonical_swap[i].cand_b));
       }
 
-      double rand = mtrand.randExc(m_tsum.back());
+      double rand = random.randExc(m_tsum.back());
 
       for(Index i = 0; i < tsize; ++i) {
         if(rand < m_tsum[i + 1]) {
-          return _propose(e, canonical_swap[i], mtrand);
+          return _propose(e, canonical_swap[i], random);
         }
       }
 
@@ -140,7 +176,8 @@ namespace CASM {
     }
 
     /// Propose grand canonical OccEvent
-    OccEvent &OccLocation::propose_grand_canonical(OccEvent &e, const OccSwap &swap, MTRand &mtrand) const {
+    template<typename RandomGenerator>
+    OccEvent &OccLocation::propose_grand_canonical(OccEvent &e, const OccSwap &swap, RandomGenerator &random) const {
       e.occ_transform.resize(1);
       e.species_traj.resize(0);
 
@@ -148,7 +185,7 @@ namespace CASM {
       Index index_cand_b = m_cand.index(swap.cand_b);
 
       OccTransform &f_a = e.occ_transform[0];
-      f_a.mol_id = m_loc[index_cand_a][mtrand.randInt(cand_size(swap.cand_a) - 1)];
+      f_a.mol_id = m_loc[index_cand_a][random.randInt(cand_size(swap.cand_a) - 1)];
       f_a.l = m_mol[f_a.mol_id].l;
       f_a.asym = m_cand[index_cand_a].asym;
       f_a.from_species = m_cand[index_cand_a].species_index;
@@ -204,12 +241,13 @@ namespace CASM {
     }
 
     /// Canonical propose
-    OccEvent &OccLocation::_propose(OccEvent &e, const OccSwap &swap, MTRand &mtrand, Index cand_a, Index cand_b, Index size_a, Index size_b) const {
+    template<typename RandomGenerator>
+    OccEvent &OccLocation::_propose(OccEvent &e, const OccSwap &swap, RandomGenerator &random, Index cand_a, Index cand_b, Index size_a, Index size_b) const {
       e.occ_transform.resize(2);
       e.species_traj.resize(0);
 
       OccTransform &f_a = e.occ_transform[0];
-      f_a.mol_id = m_loc[cand_a][mtrand.randInt(size_a - 1)];
+      f_a.mol_id = m_loc[cand_a][random.randInt(size_a - 1)];
       f_a.l = m_mol[f_a.mol_id].l;
       f_a.asym = m_cand[cand_a].asym;
       f_a.from_species = m_cand[cand_a].species_index;
@@ -217,7 +255,7 @@ namespace CASM {
       //std::cout << "size_a: " << size_a << "  loc: " << m_mol[f_a.mol_id].loc << std::endl;
 
       OccTransform &f_b = e.occ_transform[1];
-      f_b.mol_id = m_loc[cand_b][mtrand.randInt(size_b - 1)];
+      f_b.mol_id = m_loc[cand_b][random.randInt(size_b - 1)];
       f_b.l = m_mol[f_b.mol_id].l;
       f_b.asym = m_cand[cand_b].asym;
       f_b.from_species = m_cand[cand_b].species_index;
@@ -228,12 +266,18 @@ namespace CASM {
     }
 
     /// Canonical propose
-    OccEvent &OccLocation::_propose(OccEvent &e, const OccSwap &swap, MTRand &mtrand) const {
+    template<typename RandomGenerator>
+    OccEvent &OccLocation::_propose(OccEvent &e, const OccSwap &swap, RandomGenerator &random) const {
       Index cand_a = m_cand.index(swap.cand_a);
       Index cand_b = m_cand.index(swap.cand_b);
       Index size_a = m_loc[cand_a].size();
       Index size_b = m_loc[cand_b].size();
-      return _propose(e, swap, mtrand, cand_a, cand_b, size_a, size_b);
+      return _propose(e, swap, random, cand_a, cand_b, size_a, size_b);
     }
+  
+    template OccEvent &OccLocation::propose_canonical(OccEvent &, const std::vector<OccSwap> &, MTRand &) const;
+    template OccEvent &OccLocation::propose_canonical(OccEvent &, const std::vector<OccSwap> &, PhiloxRand &) const;
+    template OccEvent &OccLocation::propose_grand_canonical(OccEvent &, const OccSwap &, MTRand &) const;
+    template OccEvent &OccLocation::propose_grand_canonical(OccEvent &, const OccSwap &, PhiloxRand &) const;
   }
 }
@@ -177,7 +177,7 @@ namespace CASM {
     /// changes to. Then calculates delta properties associated with that change.
     ///
     const Canonical::EventType &Canonical::propose() {
-      m_occ_loc.propose_canonical(m_event.occ_event(), m_cand.canonical_swap(), _mtrand());
+      m_occ_loc.propose_canonical(m_event.occ_event(), m_cand.canonical_swap(), _random_generator());
       _update_deltas(m_event);
       return m_event;
     }
@@ -194,7 +194,7 @@ namespace CASM {
         return true;
       }
 
-      double rand = _mtrand().rand53();
+      double rand = _random_generator().rand53();
       double prob = exp(-event.dEpot() * m_condition.beta());
 
       if(debug()) {
@@ -249,6 +249,26 @@ namespace CASM {
       //write_pos_trajectory(settings(), *this, cond_index);
     }
 
+    /// \brief Write samples, random number generator state, and site lists, to checkpoint a calculation
+    ///
+    /// - Includes MonteCarlo::write_checkpoint, and "occ_location", the order of sites in
+    ///   OccLocation, which depends on the history of accepted events
+    jsonParser &Canonical::write_checkpoint(jsonParser &json) const {
+      MonteCarlo::write_checkpoint(json);
+      to_json(m_occ_loc.loc(), json["occ_location"]);
+      return json;
+    }
+
+    /// \brief Restore samples, random number generator state, and site lists written by write_checkpoint
+    ///
+    /// - The ConfigDoF must be set first, using 'set_state'
+    void Canonical::read_checkpoint(const jsonParser &json) {
+      MonteCarlo::read_checkpoint(json);
+      std::vector<std::vector<Index> > loc;
+      from_json(loc, json["occ_location"]);
+      m_occ_loc.set_loc(loc);
+    }
+
     /// \brief Get potential energy
     ///
     /// - if(&config == &this->config()) { return potential_energy(); }, else
@@ -534,7 +554,7 @@ namespace CASM {
         sum += val.second;
       }
 
-      double rand = _mtrand().randExc(sum);
+      double rand = _random_generator().randExc(sum);
       sum = 0.0;
       int count = 0;
       for(const auto &val : best) {
@@ -579,7 +599,7 @@ namespace CASM {
         }
 
         /// apply chosen swap (*it)
-        m_occ_loc.propose_grand_canonical(e, *it, _mtrand());
+        m_occ_loc.propose_grand_canonical(e, *it, _random_generator());
         m_occ_loc.apply(e, tconfigdof);
 
         ++count;
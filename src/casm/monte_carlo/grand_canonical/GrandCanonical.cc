@@ -174,7 +174,7 @@ namespace CASM {
   const GrandCanonical::EventType &GrandCanonical::propose() {
 
     // Randomly pick a site that's allowed more than one occupant
-    Index random_variable_site = _mtrand().randInt(m_site_swaps.variable_sites().size() - 1);
+    Index random_variable_site = _random_generator().randInt(m_site_swaps.variable_sites().size() - 1);
 
     // Determine what that site's linear index is and what the sublattice index is
     Index mutating_site = m_site_swaps.variable_sites()[random_variable_site];
@@ -185,7 +185,7 @@ namespace CASM {
 
     // Randomly pick a new occupant for the mutating site
     const std::vector<int> &possible_mutation = m_site_swaps.possible_swap()[sublat][current_occupant];
-    int new_occupant = possible_mutation[_mtrand().randInt(possible_mutation.size() - 1)];
+    int new_occupant = possible_mutation[_random_generator().randInt(possible_mutation.size() - 1)];
 
     if(debug()) {
       const auto &site_occ = primclex().get_prim().basis[sublat].site_occupant();
@@ -241,7 +241,7 @@ namespace CASM {
       return true;
     }
 
-    double rand = _mtrand().rand53();
+    double rand = _random_generator().rand53();
     double prob = exp(-event.dEpot() * m_condition.beta());
 
     if(debug()) {
@@ -1,5 +1,7 @@
 #include "casm/symmetry/SymGroup.hh"
 
+#include <set>
+#include <sstream>
 #include "casm/external/Eigen/CASM_AddOns"
 #include "casm/misc/CASM_math.hh"
 #include "casm/container/Counter.hh"
@@ -2829,8 +2831,10 @@ namespace CASM {
    *  finding the closure of a union of a large_group and a
    *  small_group. If the the new large_group is unique, add it as a
    *  large_group. Repeat for all (large_group, small_group) pairs,
-   *  until no new m_subgroups are found. This is probably not the
-   *  fastest algorithm, but it is complete
+   *  until no new m_subgroups are found.
+   *
+   *  Closures are found using a membership bitset, and uniqueness is checked
+   *  against the sorted elements of every subgroup found so far.
    */
 
   void SymGroup::_generate_subgroups() const {
@@ -2840,54 +2844,63 @@ namespace CASM {
 
     m_subgroups = small_subgroups;
 
+    // sorted elements of all subgroups found, including all equivalent subgroups
+    std::set<std::vector<Index> > found;
+    for(i = 0; i < m_subgroups.size(); i++) {
+      for(j = 0; j < m_subgroups[i].size(); j++) {
+        std::vector<Index> key(m_subgroups[i][j].begin(), m_subgroups[i][j].end());
+        std::sort(key.begin(), key.end());
+        found.insert(key);
+      }
+    }
+
+    std::vector<bool> in_group(size());
+    std::vector<Index> tgroup1;
 
     for(i = 0; i < m_subgroups.size(); i++) {
-      //std::cout << "i is " << i << " and m_subgroups.size() is " << m_subgroups.size() << std::endl;
       for(j = 0; j < small_subgroups.size(); j++) {
-        //for(ii=0; ii<m_subgroups[i].size(); ii++){
         for(jj = 0; jj < small_subgroups[j].size(); jj++) {
-          Array<Index> tgroup1(m_subgroups[i][0]);
 
-          // append unique elements from small_subgroups[j][jj]
-          for(jjj = 0; jjj < small_subgroups[j][jj].size(); jjj++) {
-            if(!tgroup1.contains(small_subgroups[j][jj][jjj])) {
-              tgroup1.push_back(small_subgroups[j][jj][jjj]);
+          // union of m_subgroups[i][0] and small_subgroups[j][jj]
+          tgroup1.clear();
+          in_group.assign(size(), false);
+          for(k = 0; k < m_subgroups[i][0].size(); k++) {
+            in_group[m_subgroups[i][0][k]] = true;
+            tgroup1.push_back(m_subgroups[i][0][k]);
+          }
+          for(k = 0; k < small_subgroups[j][jj].size(); k++) {
+            if(!in_group[small_subgroups[j][jj][k]]) {
+              in_group[small_subgroups[j][jj][k]] = true;
+              tgroup1.push_back(small_subgroups[j][jj][k]);
             }
           }
 
           // find group closure
           for(iii = 0; iii < tgroup1.size(); iii++) {
             for(jjj = 0; jjj < tgroup1.size(); jjj++) {
-              if(!tgroup1.contains(multi_table[tgroup1[iii]][tgroup1[jjj]])) {
-                tgroup1.push_back(multi_table[tgroup1[iii]][tgroup1[jjj]]);
+              Index prod = multi_table[tgroup1[iii]][tgroup1[jjj]];
+              if(!in_group[prod]) {
+                in_group[prod] = true;
+                tgroup1.push_back(prod);
               }
             }
           }
+          std::sort(tgroup1.begin(), tgroup1.end());
 
-          for(k = 0; k < m_subgroups.size(); k++) {
-            if(m_subgroups[k][0].size() == tgroup1.size()
-               && which_unique_combination(tgroup1, m_subgroups[k]) != m_subgroups[k].size()) {
-              break;
-            }
-          }
-          //std::cout << " k is " << k << " and m_subgroups.size() is " << m_subgroups.size() << std::endl;
-          if(k < m_subgroups.size())
+          if(!found.insert(tgroup1).second)
             continue;
-          // add the new group
-          //std::cout << "tgroup1 " << tgroup1 << " is unique, so we add it " << std::endl;
-          //std::cout << "tgroup2 " << tgroup2 << " yields all_in = " << tgroup1.all_in(tgroup2) << std::endl;
-          Array<Index> tconj(tgroup1);
+
+          // add the new group, and its equivalent subgroups
+          std::vector<Index> tconj(tgroup1.size());
           m_subgroups.push_back(Array< Array<Index> >());
           for(l = 0; l < alt_multi_table.size(); l++) {
             for(m = 0; m < tgroup1.size(); m++) {
-              iii = alt_multi_table[l][tgroup1[m]];
-              tconj[m] = multi_table[iii][l];
+              tconj[m] = multi_table[alt_multi_table[l][tgroup1[m]]][l];
             }
-            if(which_unique_combination(tconj, m_subgroups.back()) == m_subgroups.back().size()) {
-              tconj.sort();
-              m_subgroups.back().push_back(tconj);
+            std::sort(tconj.begin(), tconj.end());
+            if(l == 0 || found.insert(tconj).second) {
+              m_subgroups.back().push_back(Array<Index>(tconj.begin(), tconj.end()));
             }
-
           }
 
         }
@@ -3923,6 +3936,120 @@ namespace CASM {
 
   //*******************************************************************************************
 
+  std::string SymGroup::tables_hash() const {
+    std::stringstream ss;
+    auto put = [&](double val) {
+      ss << std::llround(val / TOL) << ' ';
+    };
+
+    ss << periodicity() << ' ' << size() << '\n';
+    if(m_lat_ptr) {
+      const Eigen::Matrix3d &L = lattice().lat_column_mat();
+      for(Index i = 0; i < L.size(); i++)
+        put(L(i));
+    }
+    for(Index i = 0; i < size(); i++) {
+      for(Index j = 0; j < at(i).matrix().size(); j++)
+        put(at(i).matrix()(j));
+      for(Index j = 0; j < at(i).tau().size(); j++)
+        put(at(i).tau()(j));
+      ss << '\n';
+    }
+
+    // 64-bit FNV-1a
+    std::string str = ss.str();
+    unsigned long long hash = 14695981039346656037ULL;
+    for(unsigned char c : str) {
+      hash ^= c;
+      hash *= 1099511628211ULL;
+    }
+
+    std::stringstream result;
+    result << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return result.str();
+  }
+
+  //*******************************************************************************************
+
+  jsonParser &SymGroup::tables_to_json(jsonParser &json) const {
+    get_alt_multi_table();
+    character_table();
+    subgroups();
+
+    json.put_obj();
+    json["hash"] = tables_hash();
+    json["multi_table"] = multi_table;
+    json["alt_multi_table"] = alt_multi_table;
+    json["conjugacy_classes"] = conjugacy_classes;
+    json["class_names"] = class_names;
+    json["index2conjugacy_class"] = index2conjugacy_class;
+    json["character_table"] = m_character_table;
+    json["complex_irrep"] = complex_irrep;
+    json["irrep_names"] = irrep_names;
+    json["m_subgroups"] = m_subgroups;
+    json["centralizer_table"] = centralizer_table;
+    json["elem_order_table"] = elem_order_table;
+    json["name"] = name;
+    json["latex_name"] = latex_name;
+    json["comment"] = comment;
+    return json;
+  }
+
+  //*******************************************************************************************
+
+  bool SymGroup::tables_from_json(const jsonParser &json) const {
+    if(!json.contains("hash") || json["hash"].get<std::string>() != tables_hash()) {
+      return false;
+    }
+
+    // read everything before changing any table, so that a bad cache leaves them unchanged
+    Array<Array<Index> > t_multi_table, t_alt_multi_table, t_conjugacy_classes;
+    Array<std::string> t_class_names, t_irrep_names;
+    Array<Index> t_index2conjugacy_class;
+    Array<Array<std::complex<double> > > t_character_table;
+    Array<bool> t_complex_irrep;
+    Array<Array<Array<Index> > > t_subgroups;
+    Array<Array<Index> > t_centralizer_table, t_elem_order_table;
+    std::string t_name, t_latex_name, t_comment;
+
+    CASM::from_json(t_multi_table, json["multi_table"]);
+    CASM::from_json(t_alt_multi_table, json["alt_multi_table"]);
+    CASM::from_json(t_conjugacy_classes, json["conjugacy_classes"]);
+    CASM::from_json(t_class_names, json["class_names"]);
+    CASM::from_json(t_index2conjugacy_class, json["index2conjugacy_class"]);
+    CASM::from_json(t_character_table, json["character_table"]);
+    CASM::from_json(t_complex_irrep, json["complex_irrep"]);
+    CASM::from_json(t_irrep_names, json["irrep_names"]);
+    CASM::from_json(t_subgroups, json["m_subgroups"]);
+    CASM::from_json(t_centralizer_table, json["centralizer_table"]);
+    CASM::from_json(t_elem_order_table, json["elem_order_table"]);
+    CASM::from_json(t_name, json["name"]);
+    CASM::from_json(t_latex_name, json["latex_name"]);
+    CASM::from_json(t_comment, json["comment"]);
+
+    multi_table.swap(t_multi_table);
+    alt_multi_table.swap(t_alt_multi_table);
+    conjugacy_classes.swap(t_conjugacy_classes);
+    class_names.swap(t_class_names);
+    index2conjugacy_class.swap(t_index2conjugacy_class);
+    m_character_table.swap(t_character_table);
+    complex_irrep.swap(t_complex_irrep);
+    irrep_names.swap(t_irrep_names);
+    m_subgroups.swap(t_subgroups);
+    centralizer_table.swap(t_centralizer_table);
+    elem_order_table.swap(t_elem_order_table);
+    name.swap(t_name);
+    latex_name.swap(t_latex_name);
+    comment.swap(t_comment);
+
+    // irreps are registered with the master group as they are used, as after _generate_character_table
+    irrep_IDs.clear();
+    irrep_IDs.resize(m_character_table.size());
+    return true;
+  }
+
+  //*******************************************************************************************
+
   jsonParser &to_json(const SymGroup &sym, jsonParser &json) {
     return sym.to_json(json);
   }
@@ -1,8 +1,28 @@
 #include "casm/symmetry/SymMatrixXd.hh"
 #include "casm/casm_io/json_io/container.hh"
+#include "casm/misc/CASM_math.hh"
 
 namespace CASM {
 
+  Eigen::SparseMatrix<double> const *SymMatrixXd::get_SparseMatrix() const {
+    if(!m_sparse_mat) {
+      std::vector<Eigen::Triplet<double> > nz;
+      for(Index j = 0; j < mat.cols(); j++) {
+        for(Index i = 0; i < mat.rows(); i++) {
+          if(!almost_zero(mat(i, j))) {
+            nz.push_back(Eigen::Triplet<double>(i, j, mat(i, j)));
+          }
+        }
+      }
+      std::shared_ptr<Eigen::SparseMatrix<double> > sparse_mat(new Eigen::SparseMatrix<double>(mat.rows(), mat.cols()));
+      sparse_mat->setFromTriplets(nz.begin(), nz.end());
+      m_sparse_mat = sparse_mat;
+    }
+    return m_sparse_mat.get();
+  }
+
+  //*******************************************************************************************
+
 
   jsonParser &SymMatrixXd::to_json(jsonParser &json) const {
     json.put_obj();
@@ -29,6 +49,7 @@ namespace CASM {
       CASM::from_json(m_rep_ID, json["rep_ID"]);
 
       CASM::from_json(mat, json["mat"]);
+      m_sparse_mat.reset();
     }
     catch(...) {
       /// re-throw exceptions
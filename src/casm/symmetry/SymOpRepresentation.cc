@@ -11,6 +11,12 @@ namespace CASM {
     return (master_group().representation(_rep_ID)[index()])->get_MatrixXd();
   }
 
+  //*******************************************************************************************
+  Eigen::SparseMatrix<double> const *SymOpRepresentation::get_sparse_matrix_rep(SymGroupRepID _rep_ID) const {
+    assert(has_valid_master() && !_rep_ID.empty());
+    return (master_group().representation(_rep_ID)[index()])->get_SparseMatrix();
+  }
+
   //*******************************************************************************************
 
   SymBasisPermute const *SymOpRepresentation::get_basis_permute_rep(SymGroupRepID _rep_ID) const {
@@ -35,6 +41,16 @@ namespace CASM {
     return tmat;
   }
 
+  //*******************************************************************************************
+
+  Array<Eigen::SparseMatrix<double> const * > SymOpRepresentation::get_sparse_matrix_reps(Array<SymGroupRepID> _rep_IDs) const {
+    Array<Eigen::SparseMatrix<double> const * > tmat;
+    for(Index i = 0; i < _rep_IDs.size(); i++) {
+      tmat.push_back(get_sparse_matrix_rep(_rep_IDs[i]));
+    }
+    return tmat;
+  }
+
   //**********************************************************
   void SymOpRepresentation::set_rep(SymGroupRepID _rep_ID, const SymOpRepresentation &op_rep) const {
     assert(has_valid_master() && !_rep_ID.empty());
@@ -31,6 +31,21 @@ namespace CASM {
 
   //*******************************************************************************************
 
+  Eigen::SparseMatrix<double> const *SymPermutation::get_SparseMatrix() const {
+    if(!m_sparse_mat) {
+      std::vector<Eigen::Triplet<double> > nz;
+      for(Index i = 0; i < m_permute.size(); i++) {
+        nz.push_back(Eigen::Triplet<double>(i, m_permute[i], 1.0));
+      }
+      std::shared_ptr<Eigen::SparseMatrix<double> > sparse_mat(new Eigen::SparseMatrix<double>(m_permute.size(), m_permute.size()));
+      sparse_mat->setFromTriplets(nz.begin(), nz.end());
+      m_sparse_mat = sparse_mat;
+    }
+    return m_sparse_mat.get();
+  }
+
+  //*******************************************************************************************
+
   jsonParser &SymPermutation::to_json(jsonParser &json) const {
     json.put_obj();
 
@@ -58,6 +73,7 @@ namespace CASM {
       CASM::from_json(m_rep_ID, json["rep_ID"]);
 
       CASM::from_json(m_permute, json["m_permute"]);
+      m_sparse_mat.reset();
       CASM::from_json(m_mat, json["m_mat"]);
     }
     catch(...) {
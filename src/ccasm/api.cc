@@ -6,9 +6,45 @@
 #include "casm/clex/PrimClex.hh"
 #include "casm/external/boost.hh"
 #include "casm/app/casm_functions.hh"
+#include "casm/app/ProjectSettings.hh"
+#include "casm/app/QueryHandler.hh"
+#include "casm/clex/ConfigSelection.hh"
 
 using namespace CASM;
 
+namespace {
+
+  /// Evaluate a query for selected configurations, calling 'f(row, values)' with the
+  /// 1 x n_values matrix of values for each
+  ///
+  /// - Sets 'n_config' to the number of selected configurations
+  /// - If 'first_only', only the first selected configuration is evaluated
+  /// - Returns 0 if successful, else an error code, with messages written to the
+  ///   PrimClex's err_log
+  template<typename F>
+  int _query_each(PrimClex &primclex, char *selection, char *args, bool first_only, unsigned long &n_config, F f) {
+    try {
+      ConstConfigSelection sel(primclex, std::string(selection));
+      primclex.settings().query_handler<Configuration>().set_selected(sel);
+      DataFormatter<Configuration> formatter =
+        primclex.settings().query_handler<Configuration>().dict().parse(std::string(args));
+
+      n_config = 0;
+      for(auto it = sel.selected_config_begin(); it != sel.selected_config_end(); ++it, ++n_config) {
+        if(!first_only || n_config == 0) {
+          f(n_config, formatter.evaluate_as_matrix(*it));
+        }
+      }
+      return 0;
+    }
+    catch(std::exception &e) {
+      primclex.err_log() << "Error in C API query '" << args << "': " << e.what() << "\n\n";
+      return ERR_INVALID_ARG;
+    }
+  }
+
+}
+
 extern "C" {
 
   costream *casm_STDOUT() {
@@ -134,4 +170,117 @@ extern "C" {
     return casm_api(command_args);
   }
 
+  /// Size of the values returned by casm_query_double
+  ///
+  /// \param primclex A PrimClex, which may be used repeatedly
+  /// \param selection "MASTER", "ALL", "CALCULATED", "EMPTY", or a selection file path
+  /// \param args Query properties, as for 'casm query -k', for example "corr comp formation_energy"
+  /// \param n_config Set to the number of selected configurations
+  /// \param n_values Set to the number of values per configuration
+  ///
+  /// - Returns 0 if successful, else an error code
+  int casm_query_size(cPrimClex *primclex, char *selection, char *args, unsigned long *n_config, unsigned long *n_values) {
+    PrimClex &_primclex = *reinterpret_cast<PrimClex *>(primclex);
+    *n_values = 0;
+    return _query_each(_primclex, selection, args, true, *n_config, [&](unsigned long row, const Eigen::MatrixXd & values) {
+      *n_values = values.size();
+    });
+  }
+
+  /// Evaluate a query for the selected configurations, writing values to a caller-allocated buffer
+  ///
+  /// \param primclex A PrimClex, which may be used repeatedly
+  /// \param selection "MASTER", "ALL", "CALCULATED", "EMPTY", or a selection file path
+  /// \param args Query properties, as for 'casm query -k', for example "corr comp formation_energy"
+  /// \param buffer Filled with values in row-major order, one row per selected configuration
+  /// \param buffer_size Size of 'buffer', which must be at least n_config * n_values as given
+  ///        by casm_query_size
+  ///
+  /// - Only properties with numeric values may be queried
+  /// - Returns 0 if successful, else an error code
+  int casm_query_double(cPrimClex *primclex, char *selection, char *args, double *buffer, unsigned long buffer_size) {
+    PrimClex &_primclex = *reinterpret_cast<PrimClex *>(primclex);
+    unsigned long pos = 0;
+    unsigned long n_config;
+    Index n_values = 0;
+    return _query_each(_primclex, selection, args, false, n_config, [&](unsigned long row, const Eigen::MatrixXd & values) {
+      if(row == 0) {
+        n_values = values.size();
+      }
+      else if(values.size() != n_values) {
+        throw std::runtime_error("number of values differs between configurations");
+      }
+      if(pos + values.size() > buffer_size) {
+        throw std::runtime_error("buffer is too small");
+      }
+      for(Index i = 0; i < values.size(); ++i) {
+        buffer[pos++] = values(i);
+      }
+    });
+  }
+
+  /// Number of selected configurations, and total number of sites, as required by casm_occupation
+  ///
+  /// \param primclex A PrimClex, which may be used repeatedly
+  /// \param selection "MASTER", "ALL", "CALCULATED", "EMPTY", or a selection file path
+  /// \param n_config Set to the number of selected configurations
+  /// \param n_sites Set to the total number of sites in the selected configurations
+  ///
+  /// - Returns 0 if successful, else an error code
+  int casm_occupation_size(cPrimClex *primclex, char *selection, unsigned long *n_config, unsigned long *n_sites) {
+    PrimClex &_primclex = *reinterpret_cast<PrimClex *>(primclex);
+    *n_config = 0;
+    *n_sites = 0;
+    try {
+      ConstConfigSelection sel(_primclex, std::string(selection));
+      for(auto it = sel.selected_config_begin(); it != sel.selected_config_end(); ++it) {
+        ++(*n_config);
+        *n_sites += it->size();
+      }
+    }
+    catch(std::exception &e) {
+      _primclex.err_log() << "Error in C API occupation: " << e.what() << "\n\n";
+      return ERR_INVALID_ARG;
+    }
+    return 0;
+  }
+
+  /// Occupation of the selected configurations, written to caller-allocated buffers
+  ///
+  /// \param primclex A PrimClex, which may be used repeatedly
+  /// \param selection "MASTER", "ALL", "CALCULATED", "EMPTY", or a selection file path
+  /// \param occ Filled with the occupation of each selected configuration, concatenated
+  /// \param occ_size Size of 'occ', which must be at least n_sites as given by casm_occupation_size
+  /// \param offsets Filled so that the occupation of the i-th selected configuration is in
+  ///        the range [occ + offsets[i], occ + offsets[i+1])
+  /// \param offsets_size Size of 'offsets', which must be at least n_config + 1
+  ///
+  /// - Returns 0 if successful, else an error code
+  int casm_occupation(cPrimClex *primclex, char *selection, int *occ, unsigned long occ_size, unsigned long *offsets, unsigned long offsets_size) {
+    PrimClex &_primclex = *reinterpret_cast<PrimClex *>(primclex);
+    try {
+      ConstConfigSelection sel(_primclex, std::string(selection));
+      unsigned long pos = 0;
+      unsigned long i = 0;
+      for(auto it = sel.selected_config_begin(); it != sel.selected_config_end(); ++it, ++i) {
+        const Array<int> &config_occ = it->configdof().occupation();
+        if(i + 2 > offsets_size || pos + config_occ.size() > occ_size) {
+          throw std::runtime_error("buffer is too small");
+        }
+        offsets[i] = pos;
+        std::copy(config_occ.begin(), config_occ.end(), occ + pos);
+        pos += config_occ.size();
+      }
+      if(i + 1 > offsets_size) {
+        throw std::runtime_error("buffer is too small");
+      }
+      offsets[i] = pos;
+    }
+    catch(std::exception &e) {
+      _primclex.err_log() << "Error in C API occupation: " << e.what() << "\n\n";
+      return ERR_INVALID_ARG;
+    }
+    return 0;
+  }
+
 }
@@ -0,0 +1,136 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/app/casm_functions.hh"
+
+/// What is being used to test it:
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "Common.hh"
+#include "ZrOProj.hh"
+
+using namespace CASM;
+
+namespace {
+
+  /// Send a request to 'casm server' and return the response
+  std::string _send(const fs::path &socket_path, const std::string &request) {
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strcpy(addr.sun_path, socket_path.string().c_str());
+
+    // the socket file exists slightly before the server listens
+    int fd = -1;
+    for(int i = 0; i < 50 && fd < 0; i++) {
+      fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+      if(::connect(fd, (sockaddr *) &addr, sizeof(addr)) < 0) {
+        ::close(fd);
+        fd = -1;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      }
+    }
+    if(fd < 0) {
+      throw std::runtime_error("could not connect to " + socket_path.string());
+    }
+    BOOST_REQUIRE_EQUAL(::write(fd, request.c_str(), request.size()), ssize_t(request.size()));
+    ::shutdown(fd, SHUT_WR);
+
+    std::string response;
+    char buf[4096];
+    ssize_t n;
+    while((n = ::read(fd, buf, sizeof(buf))) > 0) {
+      response.append(buf, n);
+    }
+    ::close(fd);
+    return response;
+  }
+
+  jsonParser _send(const fs::path &socket_path, const jsonParser &request) {
+    std::stringstream ss;
+    request.print(ss);
+    return jsonParser::parse(_send(socket_path, ss.str()));
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(serverTest)
+
+BOOST_AUTO_TEST_CASE(Basics) {
+
+  test::ZrOProj proj;
+  proj.check_init();
+  proj.check_composition();
+
+  Popen p;
+  p.popen(proj.cd_and() + "ccasm enum --method ScelEnum --max 2");
+  BOOST_REQUIRE_EQUAL(p.exit_code(), 0);
+  p.popen(proj.cd_and() + "ccasm enum --method ConfigEnumAllOccupations --all");
+  BOOST_REQUIRE_EQUAL(p.exit_code(), 0);
+
+  // run the server in a thread of this process
+  fs::path socket_path = proj.dir / "server_test.sock";
+  OStringStreamLog server_log;
+  OStringStreamLog server_err_log;
+  int server_returncode = -1;
+  std::thread server([&]() {
+    CommandArgs args("casm server --socket " + socket_path.string(), nullptr, proj.dir, server_log, server_err_log);
+    server_returncode = casm_api(args);
+  });
+
+  // wait for it to listen
+  for(int i = 0; i < 600 && !fs::exists(socket_path); i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  BOOST_REQUIRE_MESSAGE(fs::exists(socket_path), server_err_log.ss().str());
+
+  // only the owner may connect
+  struct stat st;
+  BOOST_REQUIRE_EQUAL(::stat(socket_path.string().c_str(), &st), 0);
+  BOOST_CHECK_EQUAL(st.st_mode & (S_IRWXG | S_IRWXO), 0);
+
+  // execute a command
+  jsonParser query;
+  query["args"] = "casm query -k comp -o STDOUT --all";
+  query["cwd"] = proj.dir.string();
+  jsonParser response = _send(socket_path, query);
+  BOOST_CHECK_MESSAGE(response["returncode"].get<int>() == 0, response["stderr"].get<std::string>());
+  std::string comp_0 = response["stdout"].get<std::string>();
+
+  // select other composition axes: this rewrites composition_axes.json with the same size,
+  // typically within the same second, and must still be seen by the server
+  p.popen(proj.cd_and() + "ccasm composition --select 1");
+  BOOST_REQUIRE_EQUAL(p.exit_code(), 0);
+  response = _send(socket_path, query);
+  BOOST_CHECK_MESSAGE(response["returncode"].get<int>() == 0, response["stderr"].get<std::string>());
+  BOOST_CHECK(response["stdout"].get<std::string>() != comp_0);
+
+  // requests that can not be executed get an error response
+  for(std::string bad_request : {"{}", "{\"args\" : 1}", "not json"}) {
+    jsonParser bad_response = jsonParser::parse(_send(socket_path, bad_request));
+    BOOST_CHECK_MESSAGE(bad_response["returncode"].get<int>() != 0, bad_request);
+    BOOST_CHECK_MESSAGE(!bad_response["stderr"].get<std::string>().empty(), bad_request);
+  }
+
+  // the server is still running
+  response = _send(socket_path, query);
+  BOOST_CHECK_EQUAL(response["returncode"].get<int>(), 0);
+
+  // stop
+  jsonParser stop;
+  stop["stop"] = true;
+  response = _send(socket_path, stop);
+  BOOST_CHECK_EQUAL(response["returncode"].get<int>(), 0);
+  server.join();
+  BOOST_CHECK_EQUAL(server_returncode, 0);
+  BOOST_CHECK(!fs::exists(socket_path));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -144,6 +144,147 @@ BOOST_AUTO_TEST_CASE(FindDiffTest) {
 
 }
 
+BOOST_AUTO_TEST_CASE(CommentsTest) {
+
+  std::string json_comments =
+    R"(// leading comment
+{
+"int" : 34, // trailing comment
+/* block comment */ "array" : [1, /* inside
+an array */ 2],
+"string" : "not // a comment /* either */" /**/
+}
+/* final comment */)";
+
+  jsonParser json = jsonParser::parse(json_comments);
+  BOOST_CHECK_EQUAL(json["int"].get<int>(), 34);
+  BOOST_CHECK_EQUAL(json["array"].size(), 2);
+  BOOST_CHECK_EQUAL(json["array"][1].get<int>(), 2);
+  BOOST_CHECK_EQUAL(json["string"].get<std::string>(), "not // a comment /* either */");
+
+  BOOST_CHECK_THROW(jsonParser::parse(std::string("{\"int\" : 34 /* unterminated}")), std::runtime_error);
+  BOOST_CHECK_THROW(jsonParser::parse(std::string("{\"int\" : 34 / }")), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(EscapesTest) {
+
+  jsonParser json = jsonParser::parse(std::string(R"(["\x41\x62", "\u0043d", "\t\n\r\b\f", "\"\\\/"])"));
+  BOOST_CHECK_EQUAL(json[0].get<std::string>(), "Ab");
+  BOOST_CHECK_EQUAL(json[1].get<std::string>(), "Cd");
+  BOOST_CHECK_EQUAL(json[2].get<std::string>(), "\t\n\r\b\f");
+  BOOST_CHECK_EQUAL(json[3].get<std::string>(), "\"\\/");
+
+  BOOST_CHECK_THROW(jsonParser::parse(std::string(R"(["\q"])")), std::runtime_error);
+  BOOST_CHECK_THROW(jsonParser::parse(std::string(R"(["\u00)")), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(NumberBoundsTest) {
+
+  jsonParser json = jsonParser::parse(std::string(
+                                        R"([9223372036854775807, -9223372036854775808,
+9223372036854775808, 18446744073709551615,
+18446744073709551616, -9223372036854775809,
+1.7976931348623157e308, 4.9406564584124654e-324, -0.5, 2e3, 2E-3])"));
+
+  // int64
+  BOOST_CHECK(json[0].type() == json_spirit::int_type && !json[0].is_uint64());
+  BOOST_CHECK_EQUAL(json[0].get_int64(), std::numeric_limits<boost::int64_t>::max());
+  BOOST_CHECK(json[1].type() == json_spirit::int_type && !json[1].is_uint64());
+  BOOST_CHECK_EQUAL(json[1].get_int64(), std::numeric_limits<boost::int64_t>::min());
+
+  // uint64
+  BOOST_CHECK(json[2].type() == json_spirit::int_type && json[2].is_uint64());
+  BOOST_CHECK_EQUAL(json[2].get_uint64(), boost::uint64_t(9223372036854775808ULL));
+  BOOST_CHECK(json[3].type() == json_spirit::int_type && json[3].is_uint64());
+  BOOST_CHECK_EQUAL(json[3].get_uint64(), std::numeric_limits<boost::uint64_t>::max());
+
+  // out of integer range: real
+  BOOST_CHECK(json[4].type() == json_spirit::real_type);
+  BOOST_CHECK_EQUAL(json[4].get_real(), 18446744073709551616.);
+  BOOST_CHECK(json[5].type() == json_spirit::real_type);
+  BOOST_CHECK_EQUAL(json[5].get_real(), -9223372036854775809.);
+
+  // real
+  BOOST_CHECK_EQUAL(json[6].get_real(), std::numeric_limits<double>::max());
+  BOOST_CHECK_EQUAL(json[7].get_real(), std::numeric_limits<double>::denorm_min());
+  BOOST_CHECK_EQUAL(json[8].get_real(), -0.5);
+  BOOST_CHECK_EQUAL(json[9].get_real(), 2000.);
+  BOOST_CHECK_EQUAL(json[10].get_real(), 0.002);
+
+  for(std::string str : {
+        "[1e999]", "[-]", "[1e]", "[1.2.3]", "[0x10]", "[1-2]"
+      }) {
+    BOOST_CHECK_THROW(jsonParser::parse(str), std::runtime_error);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(NestedTest) {
+
+  Index depth = 200;
+  std::string str;
+  for(Index i = 0; i < depth; i++) {
+    str += (i % 2) ? "[" : "{\"a\" : ";
+  }
+  str += "{\"value\" : [true, false, null]}";
+  for(Index i = depth; i > 0; i--) {
+    str += ((i - 1) % 2) ? "]" : "}";
+  }
+
+  jsonParser json = jsonParser::parse(str);
+  const jsonParser *curr = &json;
+  for(Index i = 0; i < depth; i++) {
+    BOOST_REQUIRE(curr->size() == 1);
+    curr = (i % 2) ? &(*curr)[0] : &(*curr)["a"];
+  }
+  BOOST_CHECK_EQUAL((*curr)["value"][0].get<bool>(), true);
+  BOOST_CHECK_EQUAL((*curr)["value"][1].get<bool>(), false);
+  BOOST_CHECK((*curr)["value"][2].is_null());
+
+  // later members and elements are added after nested containers
+  json = jsonParser::parse(std::string(R"({"a" : [[1, [2]], {"b" : {}}, []], "c" : {"d" : [3]}, "e" : 4})"));
+  BOOST_CHECK_EQUAL(json["a"][0][1][0].get<int>(), 2);
+  BOOST_CHECK(json["a"][1]["b"].is_obj() && json["a"][1]["b"].size() == 0);
+  BOOST_CHECK(json["a"][2].is_array() && json["a"][2].size() == 0);
+  BOOST_CHECK_EQUAL(json["c"]["d"][0].get<int>(), 3);
+  BOOST_CHECK_EQUAL(json["e"].get<int>(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(MalformedTest) {
+
+  for(std::string str : {
+        "", "{", "}", "[1,", "[1 2]", "{\"a\" 1}", "{\"a\" : }", "{\"a\" : 1,}", "{1 : 2}",
+        "{\"a\" : 1 \"b\" : 2}", "tru", "nul", "\"abc", "/* abc", "/ abc", "@"
+      }) {
+    jsonParser json;
+    std::istringstream stream(str);
+    BOOST_CHECK_MESSAGE(!json.read(stream), str);
+    BOOST_CHECK_THROW(jsonParser::parse(str), std::runtime_error);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(JsonSpiritTest) {
+
+  // the same DOM as json_spirit's reader, which jsonParser::read used previously
+  std::string json_escapes = R"({"str" : "a\tb\x41B\"\\", "list" : [-1, 0, 18446744073709551615, 1e-5, 0.1, 3.14159]})";
+  for(const std::string &str : {
+        json_str, json_escapes
+      }) {
+    jsonParser json = jsonParser::parse(str);
+
+    jsonParser spirit;
+    BOOST_REQUIRE(json_spirit::read_string(str, (json_spirit::mValue &) spirit));
+    BOOST_CHECK(json.almost_equal(spirit, 1e-14));
+
+    std::stringstream json_ss, spirit_ss;
+    json.print(json_ss);
+    spirit.print(spirit_ss);
+    BOOST_CHECK_EQUAL(json_ss.str(), spirit_ss.str());
+
+    // and read back what it writes
+    BOOST_CHECK(jsonParser::parse(json_ss.str()).almost_equal(json, 1e-10));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 //#include "../src/casm/casm_io/jsonParser.cc"
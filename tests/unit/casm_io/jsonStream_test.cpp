@@ -0,0 +1,125 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/casm_io/jsonStream.hh"
+
+/// What is being used to test it:
+#include <clocale>
+#include <locale>
+#include <sstream>
+#include <vector>
+
+using namespace CASM;
+
+namespace {
+
+  /// Records the jsonStreamReader callbacks as strings
+  struct EventRecorder {
+
+    void null_value() {
+      events.push_back("null");
+    }
+    void bool_value(bool value) {
+      events.push_back(value ? "true" : "false");
+    }
+    void int_value(boost::int64_t value) {
+      events.push_back("int " + std::to_string(value));
+    }
+    void uint_value(boost::uint64_t value) {
+      events.push_back("uint " + std::to_string(value));
+    }
+    void real_value(double value) {
+      events.push_back("real");
+      reals.push_back(value);
+    }
+    void string_value(std::string &value) {
+      events.push_back("string " + value);
+    }
+    void key(std::string &name) {
+      events.push_back("key " + name);
+    }
+    void begin_object() {
+      events.push_back("{");
+    }
+    void end_object() {
+      events.push_back("}");
+    }
+    void begin_array() {
+      events.push_back("[");
+    }
+    void end_array() {
+      events.push_back("]");
+    }
+
+    std::vector<std::string> events;
+    std::vector<double> reals;
+  };
+
+  EventRecorder _read(const std::string &str) {
+    std::istringstream stream(str);
+    EventRecorder recorder;
+    read_json_stream(stream, recorder);
+    return recorder;
+  }
+
+  /// A numeric punctuation using ',' as the decimal point
+  struct CommaDecimal : public std::numpunct<char> {
+    char do_decimal_point() const override {
+      return ',';
+    }
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(jsonStreamTest)
+
+BOOST_AUTO_TEST_CASE(EventsTest) {
+
+  EventRecorder recorder = _read(R"({"a" : [1, -2, 18446744073709551615, 0.5, "x", true, false, null], "b" : {}})");
+
+  std::vector<std::string> expected {
+    "{", "key a", "[", "int 1", "int -2", "uint 18446744073709551615", "real", "string x",
+    "true", "false", "null", "]", "key b", "{", "}", "}"
+  };
+  BOOST_CHECK(recorder.events == expected);
+  BOOST_CHECK_EQUAL(recorder.reals.size(), 1);
+  BOOST_CHECK_EQUAL(recorder.reals[0], 0.5);
+}
+
+BOOST_AUTO_TEST_CASE(SequentialTest) {
+
+  // each read consumes one value, so a stream of values can be read one at a time
+  std::istringstream stream("[1] // first\n{\"a\" : 2}");
+  EventRecorder first, second;
+  read_json_stream(stream, first);
+  read_json_stream(stream, second);
+
+  BOOST_CHECK(first.events == std::vector<std::string>({"[", "int 1", "]"}));
+  BOOST_CHECK(second.events == std::vector<std::string>({"{", "key a", "int 2", "}"}));
+}
+
+BOOST_AUTO_TEST_CASE(LocaleTest) {
+
+  std::string str = "[1.25, -2.5e-1, 0.1]";
+  std::vector<double> expected {1.25, -0.25, 0.1};
+
+  // a global C++ locale with a different decimal point
+  std::locale prev = std::locale::global(std::locale(std::locale::classic(), new CommaDecimal()));
+  EventRecorder recorder = _read(str);
+  std::locale::global(prev);
+  BOOST_CHECK(recorder.reals == expected);
+
+  // a C locale with a different decimal point, if one is installed
+  std::string prev_c = std::setlocale(LC_NUMERIC, nullptr);
+  for(std::string name : {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8"}) {
+    if(std::setlocale(LC_NUMERIC, name.c_str())) {
+      recorder = _read(str);
+      std::setlocale(LC_NUMERIC, prev_c.c_str());
+      BOOST_CHECK_MESSAGE(recorder.reals == expected, name);
+      break;
+    }
+  }
+  std::setlocale(LC_NUMERIC, prev_c.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
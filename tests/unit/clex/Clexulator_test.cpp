@@ -8,6 +8,12 @@
 
 /// What is being used to test it:
 #include <boost/filesystem.hpp>
+#include "Common.hh"
+#include "casm/app/casm_functions.hh"
+#include "casm/app/ProjectSettings.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/clex/ScelEnum.hh"
+#include "casm/clex/ConfigEnumAllOccupations.hh"
 
 using namespace CASM;
 
@@ -48,4 +54,69 @@ BOOST_AUTO_TEST_CASE(MakeClexulatorTest) {
 
 }
 
+BOOST_AUTO_TEST_CASE(DataClexulatorTest) {
+
+  test::ZrOProj proj;
+  proj.check_init();
+
+  PrimClex primclex(proj.dir, null_log());
+
+  fs::path bspecs_src = "tests/unit/monte_carlo/bspecs_0.json";
+  fs::path bspecs_dest = primclex.dir().bspecs("default");
+  fs::copy_file(bspecs_src, bspecs_dest, fs::copy_option::overwrite_if_exists);
+
+  // for autotools
+  primclex.settings().set_casm_libdir(fs::current_path() / ".libs");
+  primclex.settings().commit();
+
+  CommandArgs args("casm bset -u", &primclex, primclex.dir().root_dir(), Logging::null());
+  BOOST_REQUIRE_EQUAL(casm_api(args), 0);
+
+  const ClexDescription &desc = primclex.settings().default_clex();
+  Clexulator compiled = primclex.clexulator(desc);
+
+  // write data for the same basis set
+  Structure prim = primclex.get_prim();
+  SiteOrbitree tree = make_orbitree(prim, jsonParser(bspecs_dest), primclex.crystallography_tol());
+  tree.generate_clust_bases();
+  tree.get_index();
+
+  jsonParser data_json;
+  write_clexulator_data(prim, tree, primclex.nlist(), data_json, primclex.crystallography_tol());
+  Clexulator data(compiled.name(), data_json, primclex.nlist());
+
+  BOOST_CHECK_EQUAL(data.corr_size(), compiled.corr_size());
+  BOOST_CHECK(data.neighborhood() == compiled.neighborhood());
+
+  Eigen::VectorXd compiled_corr(compiled.corr_size()), data_corr(data.corr_size());
+
+  ScelEnumByProps scel_enum(primclex, ScelEnumProps(1, 3));
+  for(auto &scel : scel_enum) {
+    ConfigEnumAllOccupations config_enum(scel);
+    for(const auto &config : config_enum) {
+
+      BOOST_CHECK(almost_zero(correlations(config, data) - correlations(config, compiled), 1e-8));
+
+      // point and delta point correlations
+      compiled.set_config_occ(config.occupation().begin());
+      data.set_config_occ(config.occupation().begin());
+      for(Index l = 0; l < config.size(); ++l) {
+        int b = scel.get_b(l);
+        compiled.set_nlist(scel.nlist().sites(l).data());
+        data.set_nlist(scel.nlist().sites(l).data());
+
+        compiled.calc_point_corr(b, compiled_corr.data());
+        data.calc_point_corr(b, data_corr.data());
+        BOOST_CHECK(almost_zero(data_corr - compiled_corr, 1e-8));
+
+        for(int occ_f = 0; occ_f < config.get_supercell().max_allowed_occupation()[l] + 1; ++occ_f) {
+          compiled.calc_delta_point_corr(b, config.occ(l), occ_f, compiled_corr.data());
+          data.calc_delta_point_corr(b, config.occ(l), occ_f, data_corr.data());
+          BOOST_CHECK(almost_zero(data_corr - compiled_corr, 1e-8));
+        }
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,78 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/clex/CompactOccupation.hh"
+
+/// What is being used to test it:
+#include "casm/misc/PhiloxRand.hh"
+
+using namespace CASM;
+
+BOOST_AUTO_TEST_SUITE(CompactOccupationTest)
+
+BOOST_AUTO_TEST_CASE(PackTest) {
+
+  // sublattices with 1, 2, 3, and 5 allowed occupants use 0, 1, 2, and 4 bits per site
+  std::vector<int> n_occ = {1, 2, 3, 5};
+  Index volume = 100;
+  CompactOccupation compact(n_occ, volume);
+  BOOST_CHECK_EQUAL(compact.size(), 400);
+  BOOST_CHECK_EQUAL(compact.bytes(), (700 / 64 + 1) * 8);
+
+  PhiloxRand random(7);
+  Array<int> occ(compact.size());
+  for(Index l = 0; l < occ.size(); l++) {
+    occ[l] = random.randInt(n_occ[l / volume] - 1);
+  }
+  compact.set_occupation(occ);
+  BOOST_CHECK(compact.occupation() == occ);
+
+  // copies share the layout, but not the occupation
+  CompactOccupation copy(compact);
+  BOOST_CHECK(copy == compact);
+  Index l = 3 * volume + 17;
+  copy.set_occ(l, (occ[l] + 1) % 5);
+  BOOST_CHECK(copy != compact);
+  BOOST_CHECK_EQUAL(copy.occ(l), (occ[l] + 1) % 5);
+  BOOST_CHECK_EQUAL(compact.occ(l), occ[l]);
+  BOOST_CHECK_EQUAL(copy.occ(l - 1), occ[l - 1]);
+  BOOST_CHECK_EQUAL(copy.occ(l + 1), occ[l + 1]);
+}
+
+BOOST_AUTO_TEST_CASE(OddVolumeTest) {
+
+  // with an odd volume, sublattices after a 1 bit sublattice must be aligned
+  // so that their fields do not span two words
+  for(std::vector<int> n_occ : std::vector<std::vector<int> > {{2, 3}, {2, 5}, {2, 3, 2, 5}}) {
+    for(Index volume : {1, 3, 21, 63, 65, 127}) {
+      CompactOccupation compact(n_occ, volume);
+
+      PhiloxRand random(volume);
+      Array<int> occ(compact.size());
+      for(Index l = 0; l < occ.size(); l++) {
+        occ[l] = random.randInt(n_occ[l / volume] - 1);
+      }
+      compact.set_occupation(occ);
+      BOOST_CHECK(compact.occupation() == occ);
+
+      // set each site to its maximum occupant, one at a time
+      for(Index l = 0; l < occ.size(); l++) {
+        occ[l] = n_occ[l / volume] - 1;
+        compact.set_occ(l, occ[l]);
+        BOOST_CHECK_EQUAL(compact.occ(l), occ[l]);
+      }
+      BOOST_CHECK(compact.occupation() == occ);
+    }
+  }
+
+  // sublattices {2, 3}, volume 63: site 63 is the first site of the 2 bit
+  // sublattice, at bit 64
+  CompactOccupation compact(std::vector<int>({2, 3}), 63);
+  compact.set_occ(63, 2);
+  BOOST_CHECK_EQUAL(compact.occ(63), 2);
+  BOOST_CHECK_EQUAL(compact.occ(62), 0);
+  BOOST_CHECK_EQUAL(compact.occ(64), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,169 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/clex/ConfigEnumGroundState.hh"
+
+/// What is being used to test it:
+
+#include "Common.hh"
+#include "casm/app/casm_functions.hh"
+#include "casm/app/ProjectSettings.hh"
+#include "casm/clex/ScelEnum.hh"
+#include "casm/container/Counter.hh"
+#include "casm/completer/Handlers.hh"
+
+using namespace CASM;
+
+namespace {
+
+  /// Minimum potential energy per unit cell over all occupations of 'scel'
+  double brute_force_min(Supercell &scel, Clexulator &clexulator, const ECIContainer &eci, const Eigen::VectorXd &chem_pot) {
+    const PrimClex &primclex = scel.get_primclex();
+    auto to_component = get_index_converter(primclex.get_prim(), primclex.composition_axes().components());
+
+    Counter<Array<int> > counter(
+      Array<int>(scel.num_sites(), 0),
+      scel.max_allowed_occupation(),
+      Array<int>(scel.num_sites(), 1));
+
+    double min_value = std::numeric_limits<double>::max();
+    while(counter.valid()) {
+      Configuration config(scel, jsonParser(), ConfigDoF(counter()));
+      double value = eci * correlations(config, clexulator);
+      for(Index l = 0; l < config.size(); ++l) {
+        value -= chem_pot(to_component[scel.get_b(l)][config.occ(l)]) / scel.volume();
+      }
+      min_value = std::min(min_value, value);
+      ++counter;
+    }
+    return min_value;
+  }
+
+  /// Use the Monte Carlo test basis set and ECI, and compile the Clexulator
+  void init_clex(PrimClex &primclex) {
+    fs::path eci_src = "tests/unit/monte_carlo/eci_0.json";
+    fs::path eci_dest = primclex.dir().eci("formation_energy", "default", "default", "default", "default");
+    fs::copy_file(eci_src, eci_dest, fs::copy_option::overwrite_if_exists);
+
+    fs::path bspecs_src = "tests/unit/monte_carlo/bspecs_0.json";
+    fs::path bspecs_dest = primclex.dir().bspecs("default");
+    fs::copy_file(bspecs_src, bspecs_dest, fs::copy_option::overwrite_if_exists);
+
+    // for autotools
+    primclex.settings().set_casm_libdir(fs::current_path() / ".libs");
+    primclex.settings().commit();
+
+    CommandArgs args("casm bset -u", &primclex, primclex.dir().root_dir(), Logging::null());
+    BOOST_REQUIRE_EQUAL(casm_api(args), 0);
+  }
+
+  /// All supercells up to volume 'max_volume'
+  std::vector<Supercell *> make_scel_list(PrimClex &primclex, int max_volume) {
+    jsonParser json;
+    json["existing_only"] = false;
+    json["min"] = 1;
+    json["max"] = max_volume;
+    ScelEnum scel_enum(primclex, json);
+    std::vector<Supercell *> scel_list;
+    for(auto &scel : scel_enum) {
+      scel_list.push_back(&scel);
+    }
+    return scel_list;
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(ConfigEnumGroundStateTest)
+
+BOOST_AUTO_TEST_CASE(Test1) {
+
+  test::ZrOProj proj;
+  proj.check_init();
+  proj.check_composition();
+
+  PrimClex primclex(proj.dir, null_log());
+  init_clex(primclex);
+
+  const ClexDescription &desc = primclex.settings().default_clex();
+  Clexulator clexulator = primclex.clexulator(desc);
+  const ECIContainer &eci = primclex.eci(desc);
+
+  std::vector<Supercell *> scel_list = make_scel_list(primclex, 4);
+
+  const CompositionConverter &comp_axes = primclex.composition_axes();
+  for(double x : {0.0, -1.0, -2.0}) {
+    Eigen::VectorXd param_chem_pot = Eigen::VectorXd::Constant(comp_axes.independent_compositions(), x);
+    Eigen::VectorXd chem_pot = comp_axes.dparam_dmol().transpose() * param_chem_pot;
+
+    for(Supercell *scel : scel_list) {
+      ConfigEnumGroundState e(*scel, clexulator, eci, chem_pot, 60.0, 10000000, 1000000);
+      BOOST_CHECK(e.is_optimal());
+      BOOST_CHECK_SMALL(e.potential_energy() - brute_force_min(*scel, clexulator, eci, chem_pot), 1e-8);
+      BOOST_CHECK_EQUAL(std::distance(e.begin(), e.end()), 1);
+    }
+  }
+
+  {
+    Completer::EnumOption enum_opt;
+    jsonParser json;
+    json["supercells"]["max"] = 4;
+    json["supercells"]["existing_only"] = false;
+    json["param_chem_pot"]["a"] = -1.0;
+    BOOST_CHECK_EQUAL(ConfigEnumGroundState::run(primclex, json, enum_opt), 0);
+  }
+
+}
+
+BOOST_AUTO_TEST_CASE(GroupOrderTest) {
+
+  // Terms are grouped by neighborhood, and the groups are indexed in the order
+  // they are first found in the ECI. Reversing the ECI makes that order differ
+  // from the order of the neighborhoods, which the terms are constructed in,
+  // so that each group's unconstrained minimum must be assigned by group index.
+
+  test::ZrOProj proj;
+  proj.check_init();
+  proj.check_composition();
+
+  PrimClex primclex(proj.dir, null_log());
+  init_clex(primclex);
+
+  const ClexDescription &desc = primclex.settings().default_clex();
+  Clexulator clexulator = primclex.clexulator(desc);
+  const ECIContainer &default_eci = primclex.eci(desc);
+
+  std::vector<double> value(default_eci.value().rbegin(), default_eci.value().rend());
+  std::vector<ECIContainer::size_type> index(default_eci.index().rbegin(), default_eci.index().rend());
+  ECIContainer eci(value.begin(), value.end(), index.begin());
+
+  // check the groups are indexed in a different order than their neighborhoods
+  std::map<std::set<UnitCellCoord>, Index> group_index;
+  for(Index i = 0; i < eci.size(); ++i) {
+    if(eci.value()[i] != 0.0) {
+      group_index.insert(std::make_pair(clexulator.neighborhood(eci.index()[i]), group_index.size()));
+    }
+  }
+  BOOST_REQUIRE(group_index.size() >= 2);
+  std::vector<Index> order;
+  for(const auto &val : group_index) {
+    order.push_back(val.second);
+  }
+  BOOST_REQUIRE(!std::is_sorted(order.begin(), order.end()));
+
+  std::vector<Supercell *> scel_list = make_scel_list(primclex, 5);
+
+  const CompositionConverter &comp_axes = primclex.composition_axes();
+  for(double x : {0.0, -1.0, -2.0}) {
+    Eigen::VectorXd param_chem_pot = Eigen::VectorXd::Constant(comp_axes.independent_compositions(), x);
+    Eigen::VectorXd chem_pot = comp_axes.dparam_dmol().transpose() * param_chem_pot;
+
+    for(Supercell *scel : scel_list) {
+      ConfigEnumGroundState e(*scel, clexulator, eci, chem_pot, 60.0, 10000000, 1000000);
+      BOOST_CHECK(e.is_optimal());
+      BOOST_CHECK_SMALL(e.potential_energy() - brute_force_min(*scel, clexulator, eci, chem_pot), 1e-8);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
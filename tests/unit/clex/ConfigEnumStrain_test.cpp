@@ -0,0 +1,192 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/clex/ConfigEnumStrain.hh"
+
+/// What is being used to test it:
+
+#include "Common.hh"
+#include "ZrOProj.hh"
+#include "casm/app/casm_functions.hh"
+#include "casm/clex/PrimClex.hh"
+#include "casm/completer/Handlers.hh"
+
+using namespace CASM;
+
+namespace {
+
+  /// Irreducible subspaces of strain space, as used by ConfigEnumStrain
+  struct StrainSubspaces {
+
+    StrainSubspaces(const PrimClex &primclex) :
+      strain_calc("GL") {
+      strain_calc.set_symmetrized_sop(primclex.get_prim().point_group());
+      wedges = strain_calc.irreducible_wedges(primclex.get_prim().point_group(), mult);
+    }
+
+    /// Index of the first one-dimensional subspace invariant under the point group, after 'after'
+    Index invariant_subspace(Index after = -1) const {
+      Index nc = 0;
+      for(Index s = 0; s < wedges.size(); s++) {
+        if(wedges[s].cols() == 1 && mult[nc] == 1 && (after == -1 || s > after)) {
+          return s;
+        }
+        nc += wedges[s].cols();
+      }
+      return -1;
+    }
+
+    StrainConverter strain_calc;
+    std::vector<Index> mult;
+    std::vector<Eigen::MatrixXd> wedges;
+  };
+
+  /// Symmetrized strains of the enumerated configurations, checking that each is within
+  /// the strain ellipsoid
+  std::vector<Eigen::VectorXd> _strains(ConfigEnumStrain &e, const StrainSubspaces &sub, const std::vector<double> &magnitudes) {
+    std::vector<Eigen::VectorXd> result;
+    for(auto it = e.begin(); it != e.end(); ++it) {
+      Eigen::VectorXd sop = sub.strain_calc.sop_transf_mat().transpose() * sub.strain_calc.unrolled_strain_metric(it->deformation());
+      double r = 0.0;
+      Index nc = 0;
+      for(Index s = 0; s < sub.wedges.size(); s++) {
+        for(Index i = 0; i < sub.wedges[s].cols(); i++, nc++) {
+          if(magnitudes[s] > TOL) {
+            r += sop(nc) * sop(nc) / (magnitudes[s] * magnitudes[s]);
+          }
+          else {
+            BOOST_CHECK_SMALL(sop(nc), 1e-8);
+          }
+        }
+      }
+      BOOST_CHECK(r <= 1.0 + 1e-8);
+      result.push_back(sop);
+    }
+    return result;
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(ConfigEnumStrainTest)
+
+BOOST_AUTO_TEST_CASE(GridTest) {
+
+  test::ZrOProj proj;
+  proj.check_init();
+  PrimClex primclex(proj.dir, null_log());
+  Supercell scel(&primclex, primclex.get_prim().lattice());
+  Configuration config(scel);
+  config.init_occupation();
+
+  StrainSubspaces sub(primclex);
+  Index s = sub.invariant_subspace();
+  BOOST_REQUIRE(s != -1);
+
+  // a subgrid of N along a subspace invariant under the point group gives 2N+1 strains
+  // from -magnitude to +magnitude; other subspaces are not strained
+  std::vector<Index> subgrids(sub.wedges.size(), 1);
+  std::vector<double> magnitudes(sub.wedges.size(), 0.0);
+  subgrids[s] = 3;
+  magnitudes[s] = 0.1;
+  ConfigEnumStrain e(scel, config, subgrids, magnitudes, "GL");
+  std::vector<Eigen::VectorXd> strains = _strains(e, sub, magnitudes);
+  BOOST_CHECK_EQUAL(strains.size(), 7);
+  BOOST_CHECK_EQUAL(e.step(), 6);
+  for(Index i = 1; i < strains.size(); i++) {
+    BOOST_CHECK(!almost_equal(strains[i], strains[i - 1], 1e-8));
+  }
+
+  // a subgrid and magnitude are required for each subspace
+  subgrids.pop_back();
+  BOOST_CHECK_THROW(ConfigEnumStrain(scel, config, subgrids, magnitudes, "GL"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(SobolTest) {
+
+  test::ZrOProj proj;
+  proj.check_init();
+  PrimClex primclex(proj.dir, null_log());
+  Supercell scel(&primclex, primclex.get_prim().lattice());
+  Configuration config(scel);
+  config.init_occupation();
+
+  StrainSubspaces sub(primclex);
+  Index s1 = sub.invariant_subspace();
+  BOOST_REQUIRE(s1 != -1);
+  Index s2 = sub.invariant_subspace(s1);
+  BOOST_REQUIRE(s2 != -1);
+
+  std::vector<Index> subgrids(sub.wedges.size(), 1);
+  std::vector<double> magnitudes(sub.wedges.size(), 0.0);
+  subgrids[s1] = 2;
+  magnitudes[s1] = 0.1;
+
+  // along one invariant subspace, all Sobol points are in [-magnitude, magnitude)
+  {
+    ConfigEnumStrain e(scel, config, subgrids, magnitudes, "GL", 5);
+    BOOST_CHECK_EQUAL(_strains(e, sub, magnitudes).size(), 5);
+  }
+
+  // along two, the first Sobol point is the corner (-magnitude, -magnitude), outside the
+  // strain ellipsoid, and the next three are (0, 0), (0.5, -0.5), (-0.5, 0.5) * magnitude
+  subgrids[s2] = 2;
+  magnitudes[s2] = 0.1;
+  {
+    ConfigEnumStrain e(scel, config, subgrids, magnitudes, "GL", 4);
+    BOOST_CHECK_EQUAL(_strains(e, sub, magnitudes).size(), 3);
+  }
+
+  // if no point is within the strain ellipsoid, nothing is enumerated
+  {
+    ConfigEnumStrain e(scel, config, subgrids, magnitudes, "GL", 1);
+    BOOST_CHECK(e.begin() == e.end());
+  }
+
+  // wedge combinations with no points within the strain ellipsoid are skipped, and the
+  // same number of points are enumerated in each equivalent wedge combination
+  for(Index s = 0; s < sub.wedges.size(); s++) {
+    if(s != s1 && s != s2) {
+      subgrids[s] = 2;
+      magnitudes[s] = 0.1;
+    }
+  }
+  {
+    ConfigEnumStrain e(scel, config, subgrids, magnitudes, "GL", 1);
+    BOOST_CHECK(e.begin() == e.end());
+  }
+  {
+    ConfigEnumStrain e(scel, config, subgrids, magnitudes, "GL", 32);
+    std::vector<Eigen::VectorXd> strains = _strains(e, sub, magnitudes);
+    BOOST_CHECK(strains.size() > 0);
+    BOOST_CHECK(strains.size() < 32 * primclex.get_prim().point_group().size());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(RunTest) {
+
+  test::ZrOProj proj;
+  proj.check_init();
+
+  Popen p;
+  p.popen(proj.cd_and() + "ccasm enum --method ScelEnum --max 1");
+  BOOST_REQUIRE_EQUAL(p.exit_code(), 0);
+  p.popen(proj.cd_and() + "ccasm enum --method ConfigEnumAllOccupations --max 1");
+  BOOST_REQUIRE_EQUAL(p.exit_code(), 0);
+
+  PrimClex primclex(proj.dir, null_log());
+  StrainSubspaces sub(primclex);
+
+  Completer::EnumOption enum_opt;
+  jsonParser json;
+  json["configs"].put_array();
+  json["configs"].push_back(primclex.config_begin()->name());
+  json["magnitudes"] = std::vector<double>(sub.wedges.size(), 0.1);
+  json["sobol_samples"] = 8;
+  BOOST_CHECK_EQUAL(ConfigEnumStrain::run(primclex, json, enum_opt), 0);
+
+  json.erase("sobol_samples");
+  BOOST_CHECK_THROW(ConfigEnumStrain::run(primclex, json, enum_opt), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
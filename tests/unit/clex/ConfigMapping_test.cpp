@@ -0,0 +1,172 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/clex/PrimClex.hh"
+#include "casm/clex/ConfigMapping.hh"
+
+/// What is being used to test it:
+#include "Common.hh"
+#include "ZrOProj.hh"
+#include "casm/clex/ConfigDoF.hh"
+#include "casm/crystallography/SupercellEnumerator.hh"
+
+using namespace CASM;
+
+namespace {
+
+  /// \brief A relaxed-looking Structure: a ZrO supercell with some O, a strained
+  ///        lattice, and displaced atoms
+  BasicStructure<Site> _deformed_struc(PrimClex &primclex) {
+    const Structure &prim = primclex.get_prim();
+
+    Eigen::Matrix3d T;
+    T << 1, 1, 0,
+    -1, 1, 0,
+    0, 0, 2;
+    Supercell scel(&primclex, Lattice(prim.lattice().lat_column_mat() * T));
+
+    Configuration config(scel);
+    config.init_occupation();
+    for(Index l = 0; l < config.size(); l++) {
+      if(prim.basis[scel.get_b(l)].site_occupant().size() > 1 && l % 3 == 0) {
+        config.set_occ(l, 1);
+      }
+    }
+
+    BasicStructure<Site> struc(scel.superstructure(config));
+    for(Index i = struc.basis.size(); i > 0; i--) {
+      if(struc.basis[i - 1].occ_name() == "Va") {
+        struc.basis.remove(i - 1);
+      }
+    }
+    for(Index i = 0; i < struc.basis.size(); i++) {
+      struc.basis[i].cart() += 0.05 * Eigen::Vector3d(sin(i), cos(2 * i), sin(3 * i));
+    }
+
+    Eigen::Matrix3d F;
+    F << 1.02, 0.01, 0.,
+    0.01, 0.99, 0.,
+    0., 0., 1.01;
+    struc.set_lattice(Lattice(F * struc.lattice().lat_column_mat()), FRAC);
+    return struc;
+  }
+
+  /// \brief Map struc with a new ConfigMapper, and check the result matches 'expected'
+  void _check_mapping(PrimClex &primclex, const BasicStructure<Site> &struc, const ConfigDoF &expected) {
+    ConfigMapper mapper(primclex, 0.5, 0.5, ConfigMapper::robust, primclex.crystallography_tol());
+    ConfigDoF configdof;
+    Lattice lat;
+    std::vector<Index> assignment;
+    Eigen::Matrix3d cart_op;
+    BOOST_REQUIRE(mapper.deformed_struc_to_configdof(struc, configdof, lat, assignment, cart_op));
+    BOOST_CHECK(configdof.occupation() == expected.occupation());
+    BOOST_CHECK(configdof.displacement() == expected.displacement());
+    BOOST_CHECK(configdof.deformation() == expected.deformation());
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(ConfigMappingTest)
+
+BOOST_AUTO_TEST_CASE(MaxThreadsTest) {
+
+  test::ZrOProj proj;
+  proj.check_init();
+
+  PrimClex primclex(proj.dir, null_log());
+  BasicStructure<Site> struc = _deformed_struc(primclex);
+
+  ConfigMapper mapper(primclex, 0.5, 0.5, ConfigMapper::robust, primclex.crystallography_tol());
+  BOOST_CHECK(mapper.max_threads() >= 1);
+
+  // The mapping found must not depend on the number of threads
+  std::vector<ConfigDoF> configdof;
+  std::vector<Lattice> lat;
+  std::vector<std::vector<Index> > assignment;
+  std::vector<Eigen::Matrix3d> cart_op;
+  for(Index n_threads : {1, 2, 4}) {
+    mapper.set_max_threads(n_threads);
+    BOOST_CHECK_EQUAL(mapper.max_threads(), n_threads);
+
+    configdof.push_back(ConfigDoF());
+    lat.push_back(Lattice());
+    assignment.push_back(std::vector<Index>());
+    cart_op.push_back(Eigen::Matrix3d());
+    BOOST_REQUIRE(mapper.deformed_struc_to_configdof(struc, configdof.back(), lat.back(), assignment.back(), cart_op.back()));
+  }
+
+  for(Index i = 1; i < configdof.size(); i++) {
+    BOOST_CHECK(lat[i].lat_column_mat() == lat[0].lat_column_mat());
+    BOOST_CHECK(configdof[i].occupation() == configdof[0].occupation());
+    BOOST_CHECK(configdof[i].displacement() == configdof[0].displacement());
+    BOOST_CHECK(configdof[i].deformation() == configdof[0].deformation());
+    BOOST_CHECK(assignment[i] == assignment[0]);
+    BOOST_CHECK(cart_op[i] == cart_op[0]);
+  }
+
+  // The strained supercell is recovered
+  BOOST_CHECK_EQUAL(configdof[0].size(), 16);
+  BOOST_CHECK(almost_equal(std::abs(lat[0].vol()), 4 * std::abs(primclex.get_prim().lattice().vol()), 1e-8));
+}
+
+BOOST_AUTO_TEST_CASE(LatticeCacheTest) {
+
+  test::ZrOProj proj;
+  proj.check_init();
+
+  PrimClex primclex(proj.dir, null_log());
+  const Structure &prim = primclex.get_prim();
+  BasicStructure<Site> struc = _deformed_struc(primclex);
+  fs::path cache_path = primclex.dir().lattice_enum_cache();
+  fs::remove(cache_path);
+
+  // Map without a cache, which writes it
+  ConfigDoF expected;
+  {
+    ConfigMapper mapper(primclex, 0.5, 0.5, ConfigMapper::robust, primclex.crystallography_tol());
+    Lattice lat;
+    std::vector<Index> assignment;
+    Eigen::Matrix3d cart_op;
+    BOOST_REQUIRE(mapper.deformed_struc_to_configdof(struc, expected, lat, assignment, cart_op));
+  }
+  BOOST_REQUIRE(fs::exists(cache_path));
+
+  // The cached lattices are the freshly enumerated lattices
+  jsonParser cache(cache_path);
+  BOOST_REQUIRE(cache["volumes"].contains("4"));
+  for(auto vol_it = cache["volumes"].begin(); vol_it != cache["volumes"].end(); ++vol_it) {
+    Index vol = std::stol(vol_it.name());
+    std::vector<Eigen::Matrix3i> cached;
+    from_json(cached, *vol_it);
+
+    std::vector<Eigen::Matrix3i> enumerated;
+    SupercellEnumerator<Lattice> enumerator(prim.lattice(), prim.point_group(), ScelEnumProps(vol, vol + 1));
+    for(auto it = enumerator.begin(); it != enumerator.end(); ++it) {
+      Lattice canon_lat = canonical_equivalent_lattice(*it, prim.point_group(), primclex.crystallography_tol());
+      enumerated.push_back(iround(prim.lattice().inv_lat_column_mat() * canon_lat.lat_column_mat()));
+    }
+    BOOST_CHECK_MESSAGE(cached == enumerated, "volume " + vol_it.name());
+  }
+
+  // Mapping with the cache gives the same result
+  _check_mapping(primclex, struc, expected);
+
+  // An unreadable cache is ignored and replaced
+  {
+    std::ofstream file(cache_path.string().c_str());
+    file << "{\"key\" : ";
+  }
+  _check_mapping(primclex, struc, expected);
+  BOOST_CHECK(jsonParser(cache_path) == cache);
+
+  // A cache for another tolerance is ignored and replaced
+  jsonParser other = cache;
+  other["key"]["tol"] = 0.5;
+  other["volumes"]["4"].put_array();
+  other.write(cache_path);
+  _check_mapping(primclex, struc, expected);
+  BOOST_CHECK(jsonParser(cache_path) == cache);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,9 @@
 #include "FCCTernaryProj.hh"
 #include "casm/symmetry/SymInfo.hh"
 #include "casm/app/AppIO.hh"
+#include "casm/app/casm_functions.hh"
+#include "casm/app/ProjectSettings.hh"
+#include "casm/clex/PrimClex.hh"
 
 using namespace CASM;
 
@@ -194,4 +197,48 @@ BOOST_AUTO_TEST_CASE(Test2) {
 
 }
 
+BOOST_AUTO_TEST_CASE(ReferenceCorrelationsTest) {
+
+  test::ZrOProj proj;
+  proj.check_init();
+
+  PrimClex primclex(proj.dir, null_log());
+
+  fs::path bspecs_src = "tests/unit/monte_carlo/bspecs_0.json";
+  fs::path bspecs_dest = primclex.dir().bspecs("default");
+  fs::copy_file(bspecs_src, bspecs_dest, fs::copy_option::overwrite_if_exists);
+
+  // for autotools
+  primclex.settings().set_casm_libdir(fs::current_path() / ".libs");
+  primclex.settings().commit();
+
+  CommandArgs args("casm bset -u", &primclex, primclex.dir().root_dir(), Logging::null());
+  BOOST_REQUIRE_EQUAL(casm_api(args), 0);
+
+  Clexulator clexulator = primclex.clexulator(primclex.settings().default_clex());
+
+  Eigen::Matrix3i T;
+  T << 4, 0, 0,
+  0, 4, 0,
+  0, 0, 3;
+  Supercell &scel = primclex.get_supercell(primclex.add_supercell(Lattice(primclex.get_prim().lattice().lat_column_mat() * T.cast<double>())));
+
+  // reference: all sites occupied by the first allowed occupant
+  ConfigDoF ref_configdof(Array<int>(scel.num_sites(), 0));
+  Correlation ref_corr = correlations(ref_configdof, scel, clexulator);
+
+  // change a few nearby sites, and a site far away
+  ConfigDoF configdof(ref_configdof);
+  Array<int> max_occ = scel.max_allowed_occupation();
+  for(Index l : {Index(0), scel.num_sites() - 1, scel.num_sites() / 2}) {
+    configdof.occ(l) = max_occ[l];
+  }
+
+  BOOST_CHECK(almost_zero(correlations(configdof, ref_configdof, ref_corr, scel, clexulator) -
+                          correlations(configdof, scel, clexulator), 1e-8));
+
+  // no change
+  BOOST_CHECK(almost_zero(correlations(ref_configdof, ref_configdof, ref_corr, scel, clexulator) - ref_corr, 1e-8));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
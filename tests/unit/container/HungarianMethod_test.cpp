@@ -0,0 +1,82 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <numeric>
+
+/// What is being tested:
+#include "casm/misc/CASM_math.hh"
+
+using namespace CASM;
+
+namespace {
+
+  /// Minimum assignment cost, by checking all permutations
+  double brute_force_cost(const Eigen::MatrixXd &cost_matrix) {
+    std::vector<Index> perm(cost_matrix.rows());
+    std::iota(perm.begin(), perm.end(), 0);
+    double result = std::numeric_limits<double>::max();
+    do {
+      double cost = 0.0;
+      for(Index i = 0; i < perm.size(); i++) {
+        cost += cost_matrix(i, perm[i]);
+      }
+      result = std::min(result, cost);
+    }
+    while(std::next_permutation(perm.begin(), perm.end()));
+    return result;
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(HungarianMethodTest)
+
+BOOST_AUTO_TEST_CASE(RandomTest) {
+  srand(0);
+  double tol = 1e-8;
+  for(Index dim = 1; dim <= 7; dim++) {
+    for(Index trial = 0; trial < 10; trial++) {
+      Eigen::MatrixXd cost_matrix = Eigen::MatrixXd::Random(dim, dim).cwiseAbs();
+
+      std::vector<Index> assignment;
+      double cost = hungarian_method(cost_matrix, assignment, tol, std::numeric_limits<double>::max());
+      BOOST_CHECK_SMALL(cost - brute_force_cost(cost_matrix), tol);
+
+      BOOST_REQUIRE_EQUAL(assignment.size(), dim);
+      std::vector<Index> cols(assignment);
+      std::sort(cols.begin(), cols.end());
+      double check = 0.0;
+      for(Index i = 0; i < dim; i++) {
+        BOOST_CHECK_EQUAL(cols[i], i);
+        check += cost_matrix(i, assignment[i]);
+      }
+      BOOST_CHECK_SMALL(cost - check, tol);
+
+      std::vector<Index> munkres_assignment;
+      BOOST_CHECK_SMALL(cost - hungarian_method(cost_matrix, munkres_assignment, tol), tol);
+
+      // stops early if the optimal cost exceeds max_cost
+      double bound = hungarian_method(cost_matrix, assignment, tol, cost / 2.0);
+      BOOST_CHECK(assignment.empty());
+      BOOST_CHECK(bound > cost / 2.0);
+      BOOST_CHECK(bound < cost + tol);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ForbiddenTest) {
+  double tol = 1e-8;
+  double inf = 10E10;
+  Eigen::MatrixXd cost_matrix(3, 3);
+  cost_matrix << 1.0, inf, inf,
+              2.0, inf, inf,
+              0.5, 1.0, 2.0;
+
+  std::vector<Index> assignment;
+  BOOST_CHECK_EQUAL(hungarian_method(cost_matrix, assignment, tol, std::numeric_limits<double>::max()), 1e20);
+  BOOST_CHECK(assignment.empty());
+
+  cost_matrix(1, 1) = 3.0;
+  BOOST_CHECK_SMALL(hungarian_method(cost_matrix, assignment, tol, std::numeric_limits<double>::max()) - 6.0, tol);
+  BOOST_CHECK(assignment == std::vector<Index>({0, 1, 2}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,91 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/crystallography/PeriodicCellList.hh"
+
+/// What is being used to test it:
+#include "casm/crystallography/Lattice.hh"
+#include "casm/crystallography/Coordinate.hh"
+
+using namespace CASM;
+
+namespace {
+
+  /// Minimum distance over periodic images, by checking translations explicitly
+  double brute_force_dist(const Lattice &lat, const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+    double result = std::numeric_limits<double>::max();
+    for(int i = -3; i <= 3; i++) {
+      for(int j = -3; j <= 3; j++) {
+        for(int k = -3; k <= 3; k++) {
+          Eigen::Vector3d trans = lat.lat_column_mat() * Eigen::Vector3d(i, j, k);
+          result = std::min(result, (a - b + trans).norm());
+        }
+      }
+    }
+    return result;
+  }
+
+  void check_lattice(const Lattice &lat, double cutoff, Index N) {
+
+    srand(0);
+    Eigen::MatrixXd cart = lat.lat_column_mat() * Eigen::MatrixXd::Random(3, N);
+    Eigen::MatrixXd query = lat.lat_column_mat() * Eigen::MatrixXd::Random(3, N);
+
+    PeriodicCellList cell_list(lat, cutoff, N);
+    cell_list.insert_cols(cart);
+    BOOST_CHECK_EQUAL(cell_list.size(), N);
+
+    std::vector<Index> nearest = cell_list.nearest_cols(query, cutoff);
+
+    for(Index q = 0; q < N; q++) {
+      std::vector<Index> expected;
+      Index expected_nearest = N;
+      double min_dist = cutoff;
+      for(Index i = 0; i < N; i++) {
+        double dist = brute_force_dist(lat, cart.col(i), query.col(q));
+        if(dist <= cutoff) {
+          expected.push_back(i);
+          if(dist < min_dist) {
+            min_dist = dist;
+            expected_nearest = i;
+          }
+        }
+      }
+      BOOST_CHECK(cell_list.within(Eigen::Vector3d(query.col(q)), cutoff) == expected);
+      BOOST_CHECK_EQUAL(nearest[q], expected_nearest);
+    }
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(PeriodicCellListTest)
+
+BOOST_AUTO_TEST_CASE(CubicTest) {
+  Lattice lat(Eigen::Matrix3d::Identity() * 10.0);
+  check_lattice(lat, 1.5, 200);
+}
+
+BOOST_AUTO_TEST_CASE(SkewedTest) {
+  Eigen::Matrix3d lat_mat;
+  lat_mat << 6.0, 4.0, 1.0,
+          0.0, 5.0, 2.0,
+          0.0, 0.0, 7.0;
+  check_lattice(Lattice(lat_mat), 1.0, 100);
+  check_lattice(Lattice(lat_mat), 4.0, 50);
+}
+
+BOOST_AUTO_TEST_CASE(CoordinateTest) {
+  Lattice lat(Lattice::fcc());
+  PeriodicCellList cell_list(lat, 0.1);
+  Coordinate coord(Eigen::Vector3d(0.25, 0.25, 0.25), lat, FRAC);
+  Index index = cell_list.insert(coord);
+
+  Coordinate image(Eigen::Vector3d(1.25, -0.75, 2.25), lat, FRAC);
+  BOOST_CHECK_EQUAL(cell_list.nearest(image, 1e-5), index);
+
+  Coordinate other(Eigen::Vector3d(0.5, 0.25, 0.25), lat, FRAC);
+  BOOST_CHECK_EQUAL(cell_list.nearest(other, 0.1), cell_list.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -598,6 +598,30 @@ void restricted_test() {
   return;
 }
 
+void count_test() {
+  Lattice testlat(Lattice::fcc());
+  SymGroup pg;
+  testlat.generate_point_group(pg);
+
+  ScelEnumProps enum_props(1, 10 + 1, "abc");
+  SupercellEnumerator<Lattice> enumerator(testlat, pg, enum_props);
+
+  //Number of symmetrically distinct fcc supercells of volume 1 to 10
+  std::vector<long int> expected {1, 2, 3, 7, 5, 10, 7, 20, 14, 18};
+
+  std::vector<long int> enumerated(expected.size(), 0);
+  for(auto it = enumerator.begin(); it != enumerator.end(); ++it) {
+    enumerated[it.volume() - 1]++;
+  }
+
+  for(Index i = 0; i < expected.size(); i++) {
+    BOOST_CHECK_EQUAL(enumerator.count(i + 1), expected[i]);
+    BOOST_CHECK_EQUAL(enumerated[i], expected[i]);
+  }
+
+  return;
+}
+
 
 BOOST_AUTO_TEST_SUITE(SupercellEnumeratorTest)
 
@@ -686,4 +710,8 @@ BOOST_AUTO_TEST_CASE(RestrictedEnumeration) {
   restricted_test();
 }
 
+BOOST_AUTO_TEST_CASE(CountByVolume) {
+  count_test();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,64 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/misc/SobolSequence.hh"
+
+/// What is being used to test it:
+#include "casm/CASM_global_definitions.hh"
+
+using namespace CASM;
+
+BOOST_AUTO_TEST_SUITE(SobolSequenceTest)
+
+BOOST_AUTO_TEST_CASE(KnownValuesTest) {
+
+  SobolSequence sobol(3);
+  std::vector<std::vector<double> > expected = {
+    {0.0, 0.0, 0.0},
+    {0.5, 0.5, 0.5},
+    {0.75, 0.25, 0.25},
+    {0.25, 0.75, 0.75},
+    {0.375, 0.375, 0.625},
+    {0.875, 0.875, 0.125},
+    {0.625, 0.125, 0.875},
+    {0.125, 0.625, 0.375}
+  };
+
+  for(const auto &point : expected) {
+    Eigen::VectorXd x = sobol.next();
+    for(int d = 0; d < 3; d++) {
+      BOOST_CHECK_EQUAL(x(d), point[d]);
+    }
+  }
+  BOOST_CHECK_EQUAL(sobol.index(), 8);
+
+  sobol.reset();
+  BOOST_CHECK_EQUAL(sobol.next()(0), 0.0);
+  BOOST_CHECK_EQUAL(sobol.next()(0), 0.5);
+}
+
+BOOST_AUTO_TEST_CASE(StratificationTest) {
+
+  // each of the first 2^k points is in a different interval of size 2^-k, for every dimension
+  int k = 10;
+  Index N = 1 << k;
+  SobolSequence sobol(SobolSequence::max_dim);
+  std::vector<std::vector<Index> > count(sobol.dim(), std::vector<Index>(N, 0));
+  for(Index i = 0; i < N; i++) {
+    Eigen::VectorXd x = sobol.next();
+    for(int d = 0; d < sobol.dim(); d++) {
+      BOOST_CHECK(x(d) >= 0.0 && x(d) < 1.0);
+      count[d][Index(x(d) * N)]++;
+    }
+  }
+  for(int d = 0; d < sobol.dim(); d++) {
+    for(Index i = 0; i < N; i++) {
+      BOOST_CHECK_EQUAL(count[d][i], 1);
+    }
+  }
+
+  BOOST_CHECK_THROW(SobolSequence(SobolSequence::max_dim + 1), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
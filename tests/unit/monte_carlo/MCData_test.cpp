@@ -0,0 +1,98 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/monte_carlo/MCData.hh"
+
+/// What is being used to test it:
+#include "casm/external/MersenneTwister/MersenneTwister.h"
+
+using namespace CASM;
+
+namespace {
+
+  /// Correlated observations: x(i) = rho*x(i-1) + noise, starting from 'start'
+  Eigen::VectorXd ar1(MTRand &mtrand, double rho, double start, Index N) {
+    Eigen::VectorXd obs(N);
+    double x = start;
+    for(Index i = 0; i < N; i++) {
+      x = rho * x + mtrand.randNorm(0.0, 1.0);
+      obs(i) = x;
+    }
+    return obs;
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(MCDataTest)
+
+BOOST_AUTO_TEST_CASE(BlockingTest) {
+
+  MTRand mtrand(MTRand::uint32(0));
+  Index N = 1 << 16;
+  double rho = 0.9;
+  Eigen::VectorXd obs = ar1(mtrand, rho, 0.0, N);
+
+  MCDataBlocking blocking;
+  BOOST_CHECK_EQUAL(blocking.var_of_mean(), 1.0 / 0.0);
+  for(Index i = 0; i < N; i++) {
+    blocking.push_back(obs(i));
+  }
+  BOOST_CHECK_EQUAL(blocking.size(), N);
+  BOOST_CHECK_SMALL(blocking.mean() - obs.mean(), 1e-10);
+  BOOST_CHECK_SMALL(blocking.squared_norm() - obs.squaredNorm(), 1e-6 * obs.squaredNorm());
+
+  // for AR(1): Var(<X>) ~= (Var(X)/N)*(1+rho)/(1-rho), Var(X) = 1/(1-rho^2)
+  double expected = (1.0 / (1.0 - rho * rho) / N) * (1.0 + rho) / (1.0 - rho);
+  BOOST_CHECK_CLOSE(blocking.var_of_mean(), expected, 50.0);
+
+  // precision should be consistent with MCDataConvergence
+  double conf = 0.95;
+  MCDataConvergence convergence(obs, conf);
+  BOOST_CHECK_CLOSE(blocking.calculated_precision(conf), convergence.calculated_precision(), 50.0);
+
+  blocking.clear();
+  BOOST_CHECK_EQUAL(blocking.size(), 0);
+  for(Index i = 0; i < 100; i++) {
+    blocking.push_back(1.0);
+  }
+  BOOST_CHECK_EQUAL(blocking.var_of_mean(), 0.0);
+  BOOST_CHECK(blocking.is_converged(1e-8, conf));
+}
+
+BOOST_AUTO_TEST_CASE(EquilibrationUpdateTest) {
+
+  MTRand mtrand(MTRand::uint32(0));
+  Index N = 5000;
+  double prec = 0.1;
+  Eigen::VectorXd obs = ar1(mtrand, 0.95, 100.0, N);
+
+  MCDataEquilibration online;
+  for(Index n = 1; n <= N; n++) {
+    online.update(obs.head(n), prec);
+  }
+
+  MCDataEquilibration check(obs, prec);
+  BOOST_CHECK(check.is_equilibrated());
+  BOOST_CHECK(online.is_equilibrated());
+
+  // the online check keeps the partitions found by earlier updates, so it may
+  // require more equilibration samples, but should skip the initial transient
+  BOOST_CHECK(online.equilibration_samples() >= check.equilibration_samples());
+  BOOST_CHECK(online.equilibration_samples() > 50);
+  BOOST_CHECK(online.equilibration_samples() < N / 2);
+
+  // a single update matches the constructor
+  MCDataEquilibration single;
+  single.update(obs, prec);
+  BOOST_CHECK_EQUAL(single.is_equilibrated(), check.is_equilibrated());
+  BOOST_CHECK_EQUAL(single.equilibration_samples(), check.equilibration_samples());
+
+  // constant observations are equilibrated immediately
+  MCDataEquilibration constant;
+  constant.update(Eigen::VectorXd::Ones(10), prec);
+  BOOST_CHECK(constant.is_equilibrated());
+  BOOST_CHECK_EQUAL(constant.equilibration_samples(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,100 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/monte_carlo/MonteCarloEnum_impl.hh"
+
+/// What is being used to test it:
+#include <boost/filesystem.hpp>
+
+#include "Common.hh"
+#include "casm/app/casm_functions.hh"
+#include "casm/monte_carlo/MonteDriver.hh"
+#include "casm/monte_carlo/grand_canonical/GrandCanonical.hh"
+
+using namespace CASM;
+
+BOOST_AUTO_TEST_SUITE(MonteCarloEnumTest)
+
+BOOST_AUTO_TEST_CASE(HallOfFameTest) {
+
+  test::ZrOProj proj;
+  proj.check_init();
+  proj.check_composition();
+
+  PrimClex primclex(proj.dir, null_log());
+
+  fs::path eci_src = "tests/unit/monte_carlo/eci_0.json";
+  fs::path eci_dest = primclex.dir().eci("formation_energy", "default", "default", "default", "default");
+  fs::copy_file(eci_src, eci_dest, fs::copy_option::overwrite_if_exists);
+
+  fs::path bspecs_src = "tests/unit/monte_carlo/bspecs_0.json";
+  fs::path bspecs_dest = primclex.dir().bspecs("default");
+  fs::copy_file(bspecs_src, bspecs_dest, fs::copy_option::overwrite_if_exists);
+
+  // for autotools
+  primclex.settings().set_casm_libdir(fs::current_path() / ".libs");
+  primclex.settings().commit();
+
+  CommandArgs args("casm bset -u", &primclex, primclex.dir().root_dir(), Logging::null());
+  BOOST_REQUIRE_EQUAL(casm_api(args), 0);
+
+  // a small supercell at high temperature, so that occupations are often repeated and
+  // often better than the worst in a small hall of fame
+  jsonParser json(fs::path("tests/unit/monte_carlo/metropolis_grand_canonical_0.json"));
+  json["supercell"] = Eigen::Matrix3i(Eigen::Matrix3i::Identity() * 2);
+  json["data"]["storage"]["write_observations"] = false;
+  json["data"]["enumeration"]["check"] = "eq(1,1)";
+  json["data"]["enumeration"]["metric"] = "clex(formation_energy)";
+  json["data"]["enumeration"]["insert_canonical"] = true;
+  json["data"]["enumeration"]["check_existence"] = true;
+  json["data"]["enumeration"]["N_halloffame"] = 10;
+  json["data"]["enumeration"]["sample_mode"] = "on_accept";
+  json["driver"]["random_seed"] = 0;
+  json["driver"]["motif"]["configname"] = "default";
+  json["driver"]["initial_conditions"]["param_chem_pot"]["a"] = 0.0;
+  json["driver"]["initial_conditions"]["temperature"] = 2000.0;
+
+  fs::path mc_dir = primclex.dir().root_dir() / "mc_enum";
+  fs::create_directory(mc_dir);
+  fs::path settings_path = mc_dir / "settings.json";
+  json.write(settings_path);
+
+  GrandCanonicalSettings settings(primclex, settings_path);
+  Log log = null_log();
+  GrandCanonical mc(primclex, settings, log);
+  mc.set_state(settings.initial_conditions(), settings);
+
+  // MonteCarloEnum::insert skips canonicalizing configurations that can not enter the
+  // hall of fame; the reference canonicalizes and inserts every configuration
+  MonteCarloEnum e(primclex, settings, log, mc);
+  MonteCarloEnum::HallOfFameType ref(
+    MonteCarloEnumMetric(primclex.settings().query_handler<Configuration>().dict().parse("clex(formation_energy)")),
+    std::less<Configuration>(),
+    settings.enumeration_N_halloffame(),
+    settings.enumeration_tol());
+  ref.exclude(primclex.config_begin(), primclex.config_end());
+
+  Index n_accept = 0;
+  for(Index i = 0; i < 200 * mc.steps_per_pass(); ++i) {
+    if(monte_carlo_step(mc)) {
+      e.insert(mc.config());
+      ref.insert(mc.config().in_canonical_supercell().canonical_form());
+      ++n_accept;
+    }
+  }
+  BOOST_REQUIRE_MESSAGE(n_accept > 200, "n_accept: " << n_accept);
+
+  // same hall of fame
+  const MonteCarloEnum::HallOfFameType &hall = e.halloffame();
+  BOOST_REQUIRE_EQUAL(hall.size(), ref.size());
+  BOOST_CHECK_EQUAL(hall.size(), 10);
+  auto ref_it = ref.begin();
+  for(auto it = hall.begin(); it != hall.end(); ++it, ++ref_it) {
+    BOOST_CHECK_SMALL(it->first - ref_it->first, 1e-8);
+    BOOST_CHECK_EQUAL(it->second.get_supercell().get_name(), ref_it->second.get_supercell().get_name());
+    BOOST_CHECK(it->second.occupation() == ref_it->second.occupation());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,152 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/monte_carlo/MonteDriver.hh"
+
+/// What is being used to test it:
+#include <chrono>
+#include <csignal>
+#include <thread>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <boost/filesystem.hpp>
+
+#include "Common.hh"
+#include "casm/app/casm_functions.hh"
+#include "casm/external/gzstream/gzstream.h"
+#include "casm/monte_carlo/MonteIO.hh"
+#include "casm/monte_carlo/grand_canonical/GrandCanonical.hh"
+#include "casm/monte_carlo/grand_canonical/GrandCanonicalIO.hh"
+
+using namespace CASM;
+
+namespace {
+
+  /// Write settings for a fixed number of passes at one condition, with a fixed random seed
+  /// and a checkpoint after every pass, and return the path
+  fs::path _write_settings(const PrimClex &primclex, std::string name, Index N_pass) {
+
+    jsonParser json(fs::path("tests/unit/monte_carlo/metropolis_grand_canonical_0.json"));
+    json["supercell"] = Eigen::Matrix3i(Eigen::Matrix3i::Identity() * 4);
+
+    jsonParser &data = json["data"];
+    data.erase("min_pass");
+    data["N_pass"] = N_pass;
+    data["measurements"].put_array();
+    for(std::string quantity : {"formation_energy", "potential_energy", "comp"}) {
+      jsonParser tmp;
+      tmp["quantity"] = quantity;
+      data["measurements"].push_back(tmp);
+    }
+    data["storage"]["write_observations"] = true;
+    data["storage"]["output_format"] = std::vector<std::string>({"json"});
+
+    jsonParser &driver = json["driver"];
+    driver["mode"] = "custom";
+    driver["random_seed"] = 0;
+    driver["motif"]["configname"] = "default";
+    driver["custom_conditions"].put_array();
+    driver["custom_conditions"].push_back(driver["initial_conditions"]);
+    driver["custom_conditions"][0]["param_chem_pot"]["a"] = -1.0;
+    driver["custom_conditions"][0]["temperature"] = 1000.0;
+    driver["checkpoint"]["passes"] = 1;
+
+    fs::path mc_dir = primclex.dir().root_dir() / name;
+    fs::remove_all(mc_dir);
+    fs::create_directory(mc_dir);
+    fs::path settings_path = mc_dir / "settings.json";
+    json.write(settings_path);
+    return settings_path;
+  }
+
+  /// Run, or continue, the calculation and return the final random number generator state
+  jsonParser _run(PrimClex &primclex, const fs::path &settings_path) {
+    GrandCanonicalSettings settings(primclex, settings_path);
+    Log log = null_log();
+    MonteDriver<GrandCanonical> driver(primclex, settings, log, log);
+    driver.run();
+    jsonParser json;
+    return to_json(driver.mc().random_generator(), json);
+  }
+
+  /// Read the compressed observations file
+  jsonParser _observations(const MonteCarloDirectoryStructure &dir) {
+    gz::igzstream sin((dir.observations_json(0).string() + ".gz").c_str());
+    return jsonParser(sin);
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(MonteDriverTest)
+
+BOOST_AUTO_TEST_CASE(CheckpointTest) {
+
+  test::ZrOProj proj;
+  proj.check_init();
+  proj.check_composition();
+
+  PrimClex primclex(proj.dir, null_log());
+
+  fs::path eci_src = "tests/unit/monte_carlo/eci_0.json";
+  fs::path eci_dest = primclex.dir().eci("formation_energy", "default", "default", "default", "default");
+  fs::copy_file(eci_src, eci_dest, fs::copy_option::overwrite_if_exists);
+
+  fs::path bspecs_src = "tests/unit/monte_carlo/bspecs_0.json";
+  fs::path bspecs_dest = primclex.dir().bspecs("default");
+  fs::copy_file(bspecs_src, bspecs_dest, fs::copy_option::overwrite_if_exists);
+
+  // for autotools
+  primclex.settings().set_casm_libdir(fs::current_path() / ".libs");
+  primclex.settings().commit();
+
+  CommandArgs args("casm bset -u", &primclex, primclex.dir().root_dir(), Logging::null());
+  BOOST_REQUIRE_EQUAL(casm_api(args), 0);
+
+  Index N_pass = 2000;
+
+  // an uninterrupted run
+  fs::path full_settings = _write_settings(primclex, "mc_full", N_pass);
+  jsonParser full_random = _run(primclex, full_settings);
+  MonteCarloDirectoryStructure full_dir(full_settings.parent_path());
+  BOOST_REQUIRE(fs::exists(full_dir.final_state_json(0)));
+  BOOST_CHECK(!fs::exists(full_dir.checkpoint_json(0)));
+
+  // the same run, killed once it has written a checkpoint
+  fs::path resume_settings = _write_settings(primclex, "mc_resume", N_pass);
+  MonteCarloDirectoryStructure resume_dir(resume_settings.parent_path());
+
+  pid_t pid = fork();
+  BOOST_REQUIRE(pid >= 0);
+  if(pid == 0) {
+    try {
+      _run(primclex, resume_settings);
+    }
+    catch(...) {
+    }
+    _exit(0);
+  }
+
+  int status;
+  while(!fs::exists(resume_dir.checkpoint_json(0)) && waitpid(pid, &status, WNOHANG) == 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ::kill(pid, SIGKILL);
+  waitpid(pid, &status, 0);
+
+  BOOST_REQUIRE(fs::exists(resume_dir.checkpoint_json(0)));
+  BOOST_REQUIRE(!fs::exists(resume_dir.final_state_json(0)));
+  jsonParser checkpoint(resume_dir.checkpoint_json(0));
+  BOOST_CHECK(checkpoint["counter"]["pass"].get<Index>() < N_pass);
+
+  // continue from the checkpoint
+  jsonParser resume_random = _run(primclex, resume_settings);
+  BOOST_CHECK(!fs::exists(resume_dir.checkpoint_json(0)));
+
+  // same observations, random number generator state, and final ConfigDoF
+  BOOST_CHECK(_observations(resume_dir) == _observations(full_dir));
+  BOOST_CHECK(resume_random == full_random);
+  BOOST_CHECK(jsonParser(resume_dir.final_state_json(0)) == jsonParser(full_dir.final_state_json(0)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -130,6 +130,22 @@ void run_case(ProjType &proj, ConfigInit f, MTRand &mtrand) {
     check_occ(config, e, occ_loc, convert, cand_list);
     ++count;
   }
+
+  // restore the order of sites for the same configuration, as when restarting from a checkpoint
+  Monte::OccLocation restored(convert, cand_list);
+  restored.initialize(config);
+  restored.set_loc(occ_loc.loc());
+  check_occ_init(config, restored, convert, cand_list);
+
+  MTRand mtrand_a(MTRand::uint32(0));
+  MTRand mtrand_b(MTRand::uint32(0));
+  Monte::OccEvent e_restored;
+  for(Index i = 0; i < 1000; ++i) {
+    occ_loc.propose_canonical(e, cand_list.canonical_swap(), mtrand_a);
+    restored.propose_canonical(e_restored, cand_list.canonical_swap(), mtrand_b);
+    BOOST_REQUIRE_EQUAL(e.occ_transform[0].mol_id, e_restored.occ_transform[0].mol_id);
+    BOOST_REQUIRE_EQUAL(e.occ_transform[1].mol_id, e_restored.occ_transform[1].mol_id);
+  }
 }
 
 
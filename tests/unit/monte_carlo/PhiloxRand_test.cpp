@@ -0,0 +1,75 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/misc/PhiloxRand.hh"
+
+/// What is being used to test it:
+#include "casm/casm_io/jsonParser.hh"
+
+using namespace CASM;
+
+BOOST_AUTO_TEST_SUITE(PhiloxRandTest)
+
+BOOST_AUTO_TEST_CASE(KnownAnswerTest) {
+
+  // Philox4x32-10 known answer: counter = {0, 0, 0, 0}, key = {0, 0}
+  PhiloxRand random(0, 0);
+  BOOST_CHECK_EQUAL(random.randInt(), 0x6627e8d5);
+  BOOST_CHECK_EQUAL(random.randInt(), 0xe169c58d);
+  BOOST_CHECK_EQUAL(random.randInt(), 0xbc57ac4c);
+  BOOST_CHECK_EQUAL(random.randInt(), 0x9b00dbd8);
+  BOOST_CHECK_EQUAL(random.position(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(StateTest) {
+
+  PhiloxRand A(1234, 5);
+  for(int i = 0; i < 7; i++) {
+    A.rand53();
+  }
+
+  // restore from position
+  PhiloxRand B(1234, 5);
+  B.set_position(A.position());
+  for(int i = 0; i < 10; i++) {
+    BOOST_CHECK_EQUAL(A.randInt(), B.randInt());
+  }
+
+  // restore from JSON
+  jsonParser json;
+  to_json(A, json);
+  PhiloxRand C;
+  from_json(C, json);
+  BOOST_CHECK_EQUAL(C.seed(), 1234);
+  BOOST_CHECK_EQUAL(C.stream(), 5);
+  for(int i = 0; i < 10; i++) {
+    BOOST_CHECK_EQUAL(A.randInt(), C.randInt());
+  }
+
+  // different streams differ
+  PhiloxRand D(1234, 6);
+  D.set_position(A.position());
+  BOOST_CHECK(A.randInt() != D.randInt());
+}
+
+BOOST_AUTO_TEST_CASE(DistributionTest) {
+
+  PhiloxRand random(42);
+  Index N = 100000;
+  std::vector<Index> count(5, 0);
+  double sum = 0.0;
+  std::vector<double> batch(N);
+  random.rand53(batch.begin(), batch.end());
+  for(Index i = 0; i < N; i++) {
+    count[random.randInt(4)]++;
+    BOOST_CHECK(batch[i] >= 0.0 && batch[i] < 1.0);
+    sum += batch[i];
+  }
+  for(Index c : count) {
+    BOOST_CHECK(std::abs(double(c) / N - 0.2) < 0.01);
+  }
+  BOOST_CHECK(std::abs(sum / N - 0.5) < 0.01);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,74 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+/// What is being tested:
+#include "casm/symmetry/SymGroup.hh"
+
+/// What is being used to test it:
+#include "casm/crystallography/Lattice.hh"
+#include "casm/casm_io/jsonParser.hh"
+
+using namespace CASM;
+
+namespace {
+
+  Lattice _cubic() {
+    return Lattice(Eigen::Vector3d(1., 0., 0.), Eigen::Vector3d(0., 1., 0.), Eigen::Vector3d(0., 0., 1.));
+  }
+
+  Lattice _hexagonal() {
+    return Lattice(Eigen::Vector3d(1., 0., 0.), Eigen::Vector3d(-0.5, std::sqrt(3.) / 2., 0.), Eigen::Vector3d(0., 0., 1.6));
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(SymGroupTest)
+
+BOOST_AUTO_TEST_CASE(SubgroupsTest) {
+
+  jsonParser tests(fs::path("tests/unit/symmetry/SymGroup_test_cases.json"));
+
+  std::vector<std::pair<std::string, Lattice> > lat {{"Oh", _cubic()}, {"D6h", _hexagonal()}};
+  for(const auto &val : lat) {
+    SymGroup pg;
+    val.second.generate_point_group(pg);
+
+    Array<Index>::X3 expected;
+    from_json(expected, tests[val.first]);
+    BOOST_CHECK_MESSAGE(pg.subgroups() == expected, val.first);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TablesJSONTest) {
+
+  SymGroup pg;
+  _cubic().generate_point_group(pg);
+  jsonParser json;
+  pg.tables_to_json(json);
+
+  // the same group reads the tables
+  SymGroup pg2;
+  _cubic().generate_point_group(pg2);
+  BOOST_CHECK(pg2.tables_from_json(json));
+  BOOST_CHECK_EQUAL(pg2.get_name(), pg.get_name());
+  BOOST_CHECK(pg2.subgroups() == pg.subgroups());
+  BOOST_CHECK(pg2.get_multi_table() == pg.get_multi_table());
+
+  // a different group does not
+  SymGroup hex_pg;
+  _hexagonal().generate_point_group(hex_pg);
+  BOOST_CHECK(!hex_pg.tables_from_json(json));
+  BOOST_CHECK_EQUAL(hex_pg.get_name(), "D6h");
+
+  // bad tables throw, leaving the tables unchanged
+  SymGroup pg3;
+  _cubic().generate_point_group(pg3);
+  jsonParser tmp = json["m_subgroups"][0];
+  json["m_subgroups"].put_array();
+  json["m_subgroups"].push_back(tmp);
+  json["comment"].put_array();
+  BOOST_CHECK_THROW(pg3.tables_from_json(json), std::exception);
+  BOOST_CHECK(pg3.subgroups() == pg.subgroups());
+}
+
+BOOST_AUTO_TEST_SUITE_END()